@@ -55,6 +55,13 @@ public:
         return result;
     }
 
+    JsErrorCode SetThreadCount(uint32_t threadCount)
+    {
+        JsErrorCode result = JsDebugServiceSetThreadCount(m_service, threadCount);
+
+        return result;
+    }
+
     JsErrorCode Listen(uint16_t port)
     {
         JsErrorCode result = JsDebugServiceListen(m_service, port);
@@ -15,6 +15,7 @@ public:
     bool enableConsoleRedirect;
     bool loadScriptUsingBuffer;
     int port;
+    int ioThreads;
     std::vector<std::wstring> scripts;
     std::vector<std::wstring> scriptArgs;
 
@@ -25,6 +26,7 @@ public:
         , help(false)
         , loadScriptUsingBuffer(false)
         , port(9229)
+        , ioThreads(1)
     {
     }
 
@@ -57,6 +59,15 @@ public:
                         this->port = std::stoi(std::wstring(argv[index]));
                     }
                 }
+                else if (!arg.compare(L"--io-threads"))
+                {
+                    ++index;
+                    if (index < argc)
+                    {
+                        // This will return zero if no number was found.
+                        this->ioThreads = std::stoi(std::wstring(argv[index]));
+                    }
+                }
                 else if (!arg.compare(L"--script"))
                 {
                     ++index;
@@ -89,7 +100,7 @@ public:
             }
         }
 
-        if (this->port <= 0 || this->port > 65535 || this->scriptArgs.empty())
+        if (this->port <= 0 || this->port > 65535 || this->ioThreads <= 0 || this->scriptArgs.empty())
         {
             this->help = true;
         }
@@ -106,6 +117,7 @@ public:
             L"  -?  --help                 Show this help info\n"
             L"      --inspect              Enable debugging\n"
             L"      --inspect-brk          Enable debugging and break\n"
+            L"      --io-threads <number>  Specify the number of threads servicing debugger connections\n"
             L"      --no-console-redirect  Disable console redirection\n"
             L"  -p, --port <number>        Specify the port number\n"
             L"      --script <script>      Additional script to load\n"
@@ -522,6 +534,7 @@ JsErrorCode EnableDebugging(
     std::string const& runtimeName,
     bool breakOnNextLine, 
     uint16_t port, 
+    uint32_t ioThreads,
     std::unique_ptr<DebugProtocolHandler>& debugProtocolHandler,
     std::unique_ptr<DebugService>& debugService)
 {
@@ -531,6 +544,11 @@ JsErrorCode EnableDebugging(
 
     result = service->RegisterHandler(runtimeName, *protocolHandler, breakOnNextLine);
 
+    if (result == JsNoError)
+    {
+        result = service->SetThreadCount(ioThreads);
+    }
+
     if (result == JsNoError)
     {
         result = service->Listen(port);
@@ -579,7 +597,7 @@ int _cdecl wmain(int argc, wchar_t* argv[])
         if (arguments.enableDebugging)
         {
             IfFailError(
-                EnableDebugging(runtime, runtimeName, arguments.breakOnNextLine, static_cast<uint16_t>(arguments.port), debugProtocolHandler, debugService),
+                EnableDebugging(runtime, runtimeName, arguments.breakOnNextLine, static_cast<uint16_t>(arguments.port), static_cast<uint32_t>(arguments.ioThreads), debugProtocolHandler, debugService),
                 L"failed to enable debugging.");
         }
 
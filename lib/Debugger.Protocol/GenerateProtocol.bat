@@ -15,5 +15,7 @@ echo Generating files...
 
 python "%~dp0GenerateProtocol.py" --generator_script "%DEPS%\inspector_protocol\CodeGenerator.py" --jinja_dir "%DEPS%\jinja\\" --markupsafe_dir "%DEPS%\markupsafe\\" --output_base "%OUTDIR%\\" --config "%~dp0inspector_protocol_config.json"
 
+python "%~dp0..\Debugger.Service\GenerateProtocolJson.py" --protocol "%~dp0js_protocol.json" --output "%~dp0..\Debugger.Service\Generated\ProtocolJson.h"
+
 echo Generated files into %OUTDIR%
 echo.
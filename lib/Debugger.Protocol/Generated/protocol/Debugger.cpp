@@ -276,6 +276,45 @@ std::unique_ptr<API::SearchMatch> API::SearchMatch::fromJSONString(const StringV
     return protocol::Debugger::SearchMatch::fromValue(value.get(), &errors);
 }
 
+std::unique_ptr<EvaluationResult> EvaluationResult::fromValue(protocol::Value* value, ErrorSupport* errors)
+{
+    if (!value || value->type() != protocol::Value::TypeObject) {
+        errors->addError("object expected");
+        return nullptr;
+    }
+
+    std::unique_ptr<EvaluationResult> result(new EvaluationResult());
+    protocol::DictionaryValue* object = DictionaryValue::cast(value);
+    errors->push();
+    protocol::Value* resultValue = object->get("result");
+    errors->setName("result");
+    result->m_result = ValueConversions<protocol::Runtime::RemoteObject>::fromValue(resultValue, errors);
+    protocol::Value* exceptionDetailsValue = object->get("exceptionDetails");
+    if (exceptionDetailsValue) {
+        errors->setName("exceptionDetails");
+        result->m_exceptionDetails = ValueConversions<protocol::Runtime::ExceptionDetails>::fromValue(exceptionDetailsValue, errors);
+    }
+    errors->pop();
+    if (errors->hasErrors())
+        return nullptr;
+    return result;
+}
+
+std::unique_ptr<protocol::DictionaryValue> EvaluationResult::toValue() const
+{
+    std::unique_ptr<protocol::DictionaryValue> result = DictionaryValue::create();
+    result->setValue("result", ValueConversions<protocol::Runtime::RemoteObject>::toValue(m_result.get()));
+    if (m_exceptionDetails.isJust())
+        result->setValue("exceptionDetails", ValueConversions<protocol::Runtime::ExceptionDetails>::toValue(m_exceptionDetails.fromJust()));
+    return result;
+}
+
+std::unique_ptr<EvaluationResult> EvaluationResult::clone() const
+{
+    ErrorSupport errors;
+    return fromValue(toValue().get(), &errors);
+}
+
 std::unique_ptr<ScriptParsedNotification> ScriptParsedNotification::fromValue(protocol::Value* value, ErrorSupport* errors)
 {
     if (!value || value->type() != protocol::Value::TypeObject) {
@@ -550,6 +589,14 @@ std::unique_ptr<PausedNotification> PausedNotification::clone() const
 // ------------- Enum values from params.
 
 
+namespace StepUntil {
+namespace StepTypeEnum {
+const char* StepInto = "stepInto";
+const char* StepOver = "stepOver";
+const char* StepOut = "stepOut";
+} // namespace StepTypeEnum
+} // namespace StepUntil
+
 namespace SetPauseOnExceptions {
 namespace StateEnum {
 const char* None = "none";
@@ -700,6 +747,7 @@ public:
         m_dispatchMap["Debugger.stepOver"] = &DispatcherImpl::stepOver;
         m_dispatchMap["Debugger.stepInto"] = &DispatcherImpl::stepInto;
         m_dispatchMap["Debugger.stepOut"] = &DispatcherImpl::stepOut;
+        m_dispatchMap["Debugger.stepUntil"] = &DispatcherImpl::stepUntil;
         m_dispatchMap["Debugger.pause"] = &DispatcherImpl::pause;
         m_dispatchMap["Debugger.resume"] = &DispatcherImpl::resume;
         m_dispatchMap["Debugger.searchInContent"] = &DispatcherImpl::searchInContent;
@@ -708,6 +756,7 @@ public:
         m_dispatchMap["Debugger.getScriptSource"] = &DispatcherImpl::getScriptSource;
         m_dispatchMap["Debugger.setPauseOnExceptions"] = &DispatcherImpl::setPauseOnExceptions;
         m_dispatchMap["Debugger.evaluateOnCallFrame"] = &DispatcherImpl::evaluateOnCallFrame;
+        m_dispatchMap["Debugger.evaluateExpressionsOnCallFrame"] = &DispatcherImpl::evaluateExpressionsOnCallFrame;
         m_dispatchMap["Debugger.setVariableValue"] = &DispatcherImpl::setVariableValue;
         m_dispatchMap["Debugger.setAsyncCallStackDepth"] = &DispatcherImpl::setAsyncCallStackDepth;
         m_dispatchMap["Debugger.setBlackboxPatterns"] = &DispatcherImpl::setBlackboxPatterns;
@@ -734,6 +783,7 @@ protected:
     DispatchResponse::Status stepOver(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport*);
     DispatchResponse::Status stepInto(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport*);
     DispatchResponse::Status stepOut(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport*);
+    DispatchResponse::Status stepUntil(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport*);
     DispatchResponse::Status pause(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport*);
     DispatchResponse::Status resume(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport*);
     DispatchResponse::Status searchInContent(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport*);
@@ -742,6 +792,7 @@ protected:
     DispatchResponse::Status getScriptSource(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport*);
     DispatchResponse::Status setPauseOnExceptions(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport*);
     DispatchResponse::Status evaluateOnCallFrame(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport*);
+    DispatchResponse::Status evaluateExpressionsOnCallFrame(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport*);
     DispatchResponse::Status setVariableValue(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport*);
     DispatchResponse::Status setAsyncCallStackDepth(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport*);
     DispatchResponse::Status setBlackboxPatterns(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport*);
@@ -1010,6 +1061,47 @@ DispatchResponse::Status DispatcherImpl::stepOut(int callId, std::unique_ptr<Dic
     return response.status();
 }
 
+DispatchResponse::Status DispatcherImpl::stepUntil(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport* errors)
+{
+    // Prepare input parameters.
+    protocol::DictionaryValue* object = DictionaryValue::cast(requestMessageObject->get("params"));
+    errors->push();
+    protocol::Value* stepTypeValue = object ? object->get("stepType") : nullptr;
+    errors->setName("stepType");
+    String in_stepType = ValueConversions<String>::fromValue(stepTypeValue, errors);
+    protocol::Value* locationValue = object ? object->get("location") : nullptr;
+    Maybe<protocol::Debugger::Location> in_location;
+    if (locationValue) {
+        errors->setName("location");
+        in_location = ValueConversions<protocol::Debugger::Location>::fromValue(locationValue, errors);
+    }
+    protocol::Value* stopOnFrameDepthChangeValue = object ? object->get("stopOnFrameDepthChange") : nullptr;
+    Maybe<bool> in_stopOnFrameDepthChange;
+    if (stopOnFrameDepthChangeValue) {
+        errors->setName("stopOnFrameDepthChange");
+        in_stopOnFrameDepthChange = ValueConversions<bool>::fromValue(stopOnFrameDepthChangeValue, errors);
+    }
+    protocol::Value* maxStepsValue = object ? object->get("maxSteps") : nullptr;
+    Maybe<int> in_maxSteps;
+    if (maxStepsValue) {
+        errors->setName("maxSteps");
+        in_maxSteps = ValueConversions<int>::fromValue(maxStepsValue, errors);
+    }
+    errors->pop();
+    if (errors->hasErrors()) {
+        reportProtocolError(callId, DispatchResponse::kInvalidParams, kInvalidParamsString, errors);
+        return DispatchResponse::kError;
+    }
+
+    std::unique_ptr<DispatcherBase::WeakPtr> weak = weakPtr();
+    DispatchResponse response = m_backend->stepUntil(in_stepType, std::move(in_location), std::move(in_stopOnFrameDepthChange), std::move(in_maxSteps));
+    if (response.status() == DispatchResponse::kFallThrough)
+        return response.status();
+    if (weak->get())
+        weak->get()->sendResponse(callId, response);
+    return response.status();
+}
+
 DispatchResponse::Status DispatcherImpl::pause(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport* errors)
 {
 
@@ -1275,6 +1367,56 @@ DispatchResponse::Status DispatcherImpl::evaluateOnCallFrame(int callId, std::un
     return response.status();
 }
 
+DispatchResponse::Status DispatcherImpl::evaluateExpressionsOnCallFrame(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport* errors)
+{
+    // Prepare input parameters.
+    protocol::DictionaryValue* object = DictionaryValue::cast(requestMessageObject->get("params"));
+    errors->push();
+    protocol::Value* callFrameIdValue = object ? object->get("callFrameId") : nullptr;
+    errors->setName("callFrameId");
+    String in_callFrameId = ValueConversions<String>::fromValue(callFrameIdValue, errors);
+    protocol::Value* expressionsValue = object ? object->get("expressions") : nullptr;
+    errors->setName("expressions");
+    std::unique_ptr<protocol::Array<String>> in_expressions = ValueConversions<protocol::Array<String>>::fromValue(expressionsValue, errors);
+    protocol::Value* objectGroupValue = object ? object->get("objectGroup") : nullptr;
+    Maybe<String> in_objectGroup;
+    if (objectGroupValue) {
+        errors->setName("objectGroup");
+        in_objectGroup = ValueConversions<String>::fromValue(objectGroupValue, errors);
+    }
+    protocol::Value* returnByValueValue = object ? object->get("returnByValue") : nullptr;
+    Maybe<bool> in_returnByValue;
+    if (returnByValueValue) {
+        errors->setName("returnByValue");
+        in_returnByValue = ValueConversions<bool>::fromValue(returnByValueValue, errors);
+    }
+    protocol::Value* generatePreviewValue = object ? object->get("generatePreview") : nullptr;
+    Maybe<bool> in_generatePreview;
+    if (generatePreviewValue) {
+        errors->setName("generatePreview");
+        in_generatePreview = ValueConversions<bool>::fromValue(generatePreviewValue, errors);
+    }
+    errors->pop();
+    if (errors->hasErrors()) {
+        reportProtocolError(callId, DispatchResponse::kInvalidParams, kInvalidParamsString, errors);
+        return DispatchResponse::kError;
+    }
+    // Declare output parameters.
+    std::unique_ptr<protocol::Array<protocol::Debugger::EvaluationResult>> out_results;
+
+    std::unique_ptr<DispatcherBase::WeakPtr> weak = weakPtr();
+    DispatchResponse response = m_backend->evaluateExpressionsOnCallFrame(in_callFrameId, std::move(in_expressions), std::move(in_objectGroup), std::move(in_returnByValue), std::move(in_generatePreview), &out_results);
+    if (response.status() == DispatchResponse::kFallThrough)
+        return response.status();
+    std::unique_ptr<protocol::DictionaryValue> result = DictionaryValue::create();
+    if (response.status() == DispatchResponse::kSuccess) {
+        result->setValue("results", ValueConversions<protocol::Array<protocol::Debugger::EvaluationResult>>::toValue(out_results.get()));
+    }
+    if (weak->get())
+        weak->get()->sendResponse(callId, response, std::move(result));
+    return response.status();
+}
+
 DispatchResponse::Status DispatcherImpl::setVariableValue(int callId, std::unique_ptr<DictionaryValue> requestMessageObject, ErrorSupport* errors)
 {
     // Prepare input parameters.
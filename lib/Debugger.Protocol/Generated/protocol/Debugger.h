@@ -25,12 +25,21 @@ class ScriptPosition;
 class CallFrame;
 class Scope;
 class SearchMatch;
+class EvaluationResult;
 class ScriptParsedNotification;
 class ScriptFailedToParseNotification;
 class BreakpointResolvedNotification;
 class PausedNotification;
 using ResumedNotification = Object;
 
+namespace StepUntil {
+namespace StepTypeEnum {
+ extern const char* StepInto;
+ extern const char* StepOver;
+ extern const char* StepOut;
+} // StepTypeEnum
+} // StepUntil
+
 namespace SetPauseOnExceptions {
 namespace StateEnum {
  extern const char* None;
@@ -541,6 +550,79 @@ private:
 };
 
 
+class  EvaluationResult : public Serializable{
+    PROTOCOL_DISALLOW_COPY(EvaluationResult);
+public:
+    static std::unique_ptr<EvaluationResult> fromValue(protocol::Value* value, ErrorSupport* errors);
+
+    ~EvaluationResult() override { }
+
+    protocol::Runtime::RemoteObject* getResult() { return m_result.get(); }
+    void setResult(std::unique_ptr<protocol::Runtime::RemoteObject> value) { m_result = std::move(value); }
+
+    bool hasExceptionDetails() { return m_exceptionDetails.isJust(); }
+    protocol::Runtime::ExceptionDetails* getExceptionDetails(protocol::Runtime::ExceptionDetails* defaultValue) { return m_exceptionDetails.isJust() ? m_exceptionDetails.fromJust() : defaultValue; }
+    void setExceptionDetails(std::unique_ptr<protocol::Runtime::ExceptionDetails> value) { m_exceptionDetails = std::move(value); }
+
+    std::unique_ptr<protocol::DictionaryValue> toValue() const;
+    String serialize() override { return toValue()->serialize(); }
+    std::unique_ptr<EvaluationResult> clone() const;
+
+    template<int STATE>
+    class EvaluationResultBuilder {
+    public:
+        enum {
+            NoFieldsSet = 0,
+            ResultSet = 1 << 1,
+            AllFieldsSet = (ResultSet | 0)};
+
+
+        EvaluationResultBuilder<STATE | ResultSet>& setResult(std::unique_ptr<protocol::Runtime::RemoteObject> value)
+        {
+            static_assert(!(STATE & ResultSet), "property result should not be set yet");
+            m_result->setResult(std::move(value));
+            return castState<ResultSet>();
+        }
+
+        EvaluationResultBuilder<STATE>& setExceptionDetails(std::unique_ptr<protocol::Runtime::ExceptionDetails> value)
+        {
+            m_result->setExceptionDetails(std::move(value));
+            return *this;
+        }
+
+        std::unique_ptr<EvaluationResult> build()
+        {
+            static_assert(STATE == AllFieldsSet, "state should be AllFieldsSet");
+            return std::move(m_result);
+        }
+
+    private:
+        friend class EvaluationResult;
+        EvaluationResultBuilder() : m_result(new EvaluationResult()) { }
+
+        template<int STEP> EvaluationResultBuilder<STATE | STEP>& castState()
+        {
+            return *reinterpret_cast<EvaluationResultBuilder<STATE | STEP>*>(this);
+        }
+
+        std::unique_ptr<protocol::Debugger::EvaluationResult> m_result;
+    };
+
+    static EvaluationResultBuilder<0> create()
+    {
+        return EvaluationResultBuilder<0>();
+    }
+
+private:
+    EvaluationResult()
+    {
+    }
+
+    std::unique_ptr<protocol::Runtime::RemoteObject> m_result;
+    Maybe<protocol::Runtime::ExceptionDetails> m_exceptionDetails;
+};
+
+
 class  ScriptParsedNotification : public Serializable{
     PROTOCOL_DISALLOW_COPY(ScriptParsedNotification);
 public:
@@ -1129,6 +1211,7 @@ public:
     virtual DispatchResponse stepOver() = 0;
     virtual DispatchResponse stepInto() = 0;
     virtual DispatchResponse stepOut() = 0;
+    virtual DispatchResponse stepUntil(const String& in_stepType, Maybe<protocol::Debugger::Location> in_location, Maybe<bool> in_stopOnFrameDepthChange, Maybe<int> in_maxSteps) = 0;
     virtual DispatchResponse pause() = 0;
     virtual DispatchResponse resume() = 0;
     virtual DispatchResponse searchInContent(const String& in_scriptId, const String& in_query, Maybe<bool> in_caseSensitive, Maybe<bool> in_isRegex, std::unique_ptr<protocol::Array<protocol::Debugger::SearchMatch>>* out_result) = 0;
@@ -1137,6 +1220,7 @@ public:
     virtual DispatchResponse getScriptSource(const String& in_scriptId, String* out_scriptSource) = 0;
     virtual DispatchResponse setPauseOnExceptions(const String& in_state) = 0;
     virtual DispatchResponse evaluateOnCallFrame(const String& in_callFrameId, const String& in_expression, Maybe<String> in_objectGroup, Maybe<bool> in_includeCommandLineAPI, Maybe<bool> in_silent, Maybe<bool> in_returnByValue, Maybe<bool> in_generatePreview, std::unique_ptr<protocol::Runtime::RemoteObject>* out_result, Maybe<protocol::Runtime::ExceptionDetails>* out_exceptionDetails) = 0;
+    virtual DispatchResponse evaluateExpressionsOnCallFrame(const String& in_callFrameId, std::unique_ptr<protocol::Array<String>> in_expressions, Maybe<String> in_objectGroup, Maybe<bool> in_returnByValue, Maybe<bool> in_generatePreview, std::unique_ptr<protocol::Array<protocol::Debugger::EvaluationResult>>* out_results) = 0;
     virtual DispatchResponse setVariableValue(int in_scopeNumber, const String& in_variableName, std::unique_ptr<protocol::Runtime::CallArgument> in_newValue, const String& in_callFrameId) = 0;
     virtual DispatchResponse setAsyncCallStackDepth(int in_maxDepth) = 0;
     virtual DispatchResponse setBlackboxPatterns(std::unique_ptr<protocol::Array<String>> in_patterns) = 0;
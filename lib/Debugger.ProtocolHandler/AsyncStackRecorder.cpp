@@ -0,0 +1,467 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+#include "AsyncStackRecorder.h"
+
+#include "Debugger.h"
+#include "DebuggerContext.h"
+#include "ErrorHelpers.h"
+#include "PropertyHelpers.h"
+
+#include <cstdlib>
+#include <sstream>
+
+namespace JsDebug
+{
+    using protocol::Array;
+    using protocol::Runtime::CallFrame;
+    using protocol::Runtime::StackTrace;
+    using protocol::String;
+
+    namespace
+    {
+        const size_t c_MaxTaskRecords = 1024;
+
+        // The engine stops at Error.stackTraceLimit frames, which is 10 unless script raises it. This keeps a raised
+        // limit from making every record larger.
+        const size_t c_MaxFramesPerStack = 32;
+        const char c_FramePrefix[] = "at ";
+
+        std::unordered_map<std::string, int> GetScriptIdsByUrl()
+        {
+            std::unordered_map<std::string, int> scriptIds;
+
+            JsValueRef scripts = JS_INVALID_REFERENCE;
+            if (JsDiagGetScripts(&scripts) != JsNoError)
+            {
+                return scriptIds;
+            }
+
+            int length = PropertyHelpers::GetPropertyInt(scripts, PropertyHelpers::Names::Length);
+            for (int index = 0; index < length; index++)
+            {
+                JsValueRef script = PropertyHelpers::GetIndexedProperty(scripts, index);
+
+                String16 fileName;
+                if (PropertyHelpers::TryGetProperty(script, PropertyHelpers::Names::FileName, &fileName))
+                {
+                    scriptIds[fileName.toUtf8()] = PropertyHelpers::GetPropertyInt(
+                        script,
+                        PropertyHelpers::Names::ScriptId);
+                }
+            }
+
+            return scriptIds;
+        }
+    }
+
+    bool AsyncStackRecorder::Frame::operator==(const Frame& other) const
+    {
+        return url == other.url &&
+            line == other.line &&
+            column == other.column &&
+            functionName == other.functionName;
+    }
+
+    AsyncStackRecorder::AsyncStackRecorder(Debugger* debugger)
+        : m_debugger(debugger)
+        , m_maxDepth(0)
+        , m_nextSequence(1)
+    {
+    }
+
+    int AsyncStackRecorder::GetMaxDepth() const
+    {
+        return m_maxDepth;
+    }
+
+    void AsyncStackRecorder::SetMaxDepth(int maxDepth)
+    {
+        m_maxDepth = maxDepth > 0 ? maxDepth : 0;
+
+        if (m_maxDepth == 0)
+        {
+            Clear();
+        }
+        else if (m_records.empty())
+        {
+            m_records.resize(c_MaxTaskRecords, TaskRecord());
+        }
+    }
+
+    void AsyncStackRecorder::TaskScheduled(void* task, const char* description)
+    {
+        if (m_maxDepth == 0)
+        {
+            return;
+        }
+
+        int stack = InternStack(CaptureFrames());
+
+        uint64_t sequence = m_nextSequence++;
+        TaskRecord& record = m_records[sequence % m_records.size()];
+        EvictRecord(record);
+
+        record.task = task;
+        record.sequence = sequence;
+        record.parent = m_runningTasks.empty() ? 0 : m_runningTasks.back();
+        record.stack = stack;
+        record.description = Intern(description != nullptr ? description : "");
+
+        m_taskLookup[task] = sequence;
+    }
+
+    void AsyncStackRecorder::TaskStarted(void* task)
+    {
+        if (m_maxDepth == 0)
+        {
+            return;
+        }
+
+        // Tasks that weren't recorded are still tracked so that started and finished calls stay paired.
+        auto it = m_taskLookup.find(task);
+        m_runningTasks.push_back(it != m_taskLookup.end() ? it->second : 0);
+    }
+
+    void AsyncStackRecorder::TaskFinished(void* task)
+    {
+        if (m_maxDepth == 0)
+        {
+            return;
+        }
+
+        // A task that started before recording was turned on was never pushed, so there may be nothing to pop.
+        if (!m_runningTasks.empty())
+        {
+            m_runningTasks.pop_back();
+        }
+
+        m_taskLookup.erase(task);
+    }
+
+    std::unique_ptr<StackTrace> AsyncStackRecorder::GetAsyncStackTrace()
+    {
+        if (m_maxDepth == 0 || m_runningTasks.empty())
+        {
+            return nullptr;
+        }
+
+        std::vector<const TaskRecord*> chain;
+        const TaskRecord* record = FindRecord(m_runningTasks.back());
+
+        while (record != nullptr && static_cast<int>(chain.size()) < m_maxDepth)
+        {
+            chain.push_back(record);
+            record = FindRecord(record->parent);
+        }
+
+        // Scripts are only looked up by url here, since pauses are far less frequent than scheduled tasks.
+        std::unordered_map<std::string, int> scriptIds = GetScriptIdsByUrl();
+
+        // Build from the outermost record inwards so each trace can take ownership of its parent.
+        std::unique_ptr<StackTrace> stackTrace;
+
+        for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+        {
+            auto callFrames = Array<CallFrame>::create();
+
+            for (const Frame& frame : m_stacks[(*it)->stack].frames)
+            {
+                const std::string& url = m_atoms[frame.url].value;
+                const std::string& functionName = m_atoms[frame.functionName].value;
+
+                auto scriptId = scriptIds.find(url);
+
+                callFrames->addItem(CallFrame::create()
+                    .setFunctionName(String::fromUtf8(functionName.c_str(), functionName.length()))
+                    .setScriptId(String::fromInteger(scriptId != scriptIds.end() ? scriptId->second : 0))
+                    .setUrl(String::fromUtf8(url.c_str(), url.length()))
+                    .setLineNumber(frame.line)
+                    .setColumnNumber(frame.column)
+                    .build());
+            }
+
+            const std::string& description = m_atoms[(*it)->description].value;
+
+            std::unique_ptr<StackTrace> current = StackTrace::create()
+                .setCallFrames(std::move(callFrames))
+                .build();
+
+            if (!description.empty())
+            {
+                current->setDescription(String::fromUtf8(description.c_str(), description.length()));
+            }
+
+            if (stackTrace != nullptr)
+            {
+                current->setParent(std::move(stackTrace));
+            }
+
+            stackTrace = std::move(current);
+        }
+
+        return stackTrace;
+    }
+
+    int AsyncStackRecorder::Intern(const std::string& str)
+    {
+        auto it = m_atomLookup.find(str);
+        if (it != m_atomLookup.end())
+        {
+            m_atoms[it->second].refCount++;
+            return it->second;
+        }
+
+        int atom = 0;
+        if (!m_freeAtoms.empty())
+        {
+            atom = m_freeAtoms.back();
+            m_freeAtoms.pop_back();
+        }
+        else
+        {
+            atom = static_cast<int>(m_atoms.size());
+            m_atoms.emplace_back();
+        }
+
+        m_atoms[atom].value = str;
+        m_atoms[atom].refCount = 1;
+        m_atomLookup.emplace(str, atom);
+
+        return atom;
+    }
+
+    void AsyncStackRecorder::ReleaseAtom(int atom)
+    {
+        Atom& entry = m_atoms[atom];
+        if (--entry.refCount > 0)
+        {
+            return;
+        }
+
+        m_atomLookup.erase(entry.value);
+        std::string().swap(entry.value);
+        m_freeAtoms.push_back(atom);
+    }
+
+    void AsyncStackRecorder::ReleaseFrames(const std::vector<Frame>& frames)
+    {
+        for (const Frame& frame : frames)
+        {
+            ReleaseAtom(frame.url);
+            ReleaseAtom(frame.functionName);
+        }
+    }
+
+    int AsyncStackRecorder::InternStack(std::vector<Frame>&& frames)
+    {
+        size_t hash = frames.size();
+        for (const Frame& frame : frames)
+        {
+            hash = hash * 31 + static_cast<size_t>(frame.url);
+            hash = hash * 31 + static_cast<size_t>(frame.line);
+            hash = hash * 31 + static_cast<size_t>(frame.column);
+            hash = hash * 31 + static_cast<size_t>(frame.functionName);
+        }
+
+        auto range = m_stackLookup.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            Stack& existing = m_stacks[it->second];
+            if (existing.frames == frames)
+            {
+                // The existing stack already holds references to the same atoms.
+                ReleaseFrames(frames);
+                existing.refCount++;
+                return it->second;
+            }
+        }
+
+        int stack = 0;
+        if (!m_freeStacks.empty())
+        {
+            stack = m_freeStacks.back();
+            m_freeStacks.pop_back();
+        }
+        else
+        {
+            stack = static_cast<int>(m_stacks.size());
+            m_stacks.emplace_back();
+        }
+
+        Stack& entry = m_stacks[stack];
+        entry.frames = std::move(frames);
+        entry.hash = hash;
+        entry.refCount = 1;
+
+        m_stackLookup.emplace(hash, stack);
+        return stack;
+    }
+
+    void AsyncStackRecorder::ReleaseStack(int stack)
+    {
+        Stack& entry = m_stacks[stack];
+        if (--entry.refCount > 0)
+        {
+            return;
+        }
+
+        auto range = m_stackLookup.equal_range(entry.hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == stack)
+            {
+                m_stackLookup.erase(it);
+                break;
+            }
+        }
+
+        ReleaseFrames(entry.frames);
+        entry.frames.clear();
+        m_freeStacks.push_back(stack);
+    }
+
+    void AsyncStackRecorder::EvictRecord(TaskRecord& record)
+    {
+        if (record.sequence == 0)
+        {
+            return;
+        }
+
+        auto it = m_taskLookup.find(record.task);
+        if (it != m_taskLookup.end() && it->second == record.sequence)
+        {
+            m_taskLookup.erase(it);
+        }
+
+        ReleaseStack(record.stack);
+        ReleaseAtom(record.description);
+        record = TaskRecord();
+    }
+
+    const AsyncStackRecorder::TaskRecord* AsyncStackRecorder::FindRecord(uint64_t sequence) const
+    {
+        if (sequence == 0 || m_records.empty())
+        {
+            return nullptr;
+        }
+
+        // The slot may have been reused by a newer task, in which case the record is gone.
+        const TaskRecord& record = m_records[sequence % m_records.size()];
+        return record.sequence == sequence ? &record : nullptr;
+    }
+
+    std::vector<AsyncStackRecorder::Frame> AsyncStackRecorder::CaptureFrames()
+    {
+        std::vector<Frame> frames;
+
+        JsContextRef currentContext = JS_INVALID_REFERENCE;
+        if (JsGetCurrentContext(&currentContext) != JsNoError || currentContext == JS_INVALID_REFERENCE)
+        {
+            // Tasks scheduled outside of script have no stack to record.
+            return frames;
+        }
+
+        DebuggerContext::Scope debuggerScope(*m_debugger->GetDebugContext());
+
+        if (m_errorConstructor.IsEmpty())
+        {
+            JsValueRef globalObject = JS_INVALID_REFERENCE;
+            IfJsErrorThrow(JsGetGlobalObject(&globalObject));
+            m_errorConstructor = PropertyHelpers::GetProperty(globalObject, PropertyHelpers::Names::Error);
+        }
+
+        JsValueRef undefined = JS_INVALID_REFERENCE;
+        IfJsErrorThrow(JsGetUndefinedValue(&undefined));
+
+        JsValueRef error = JS_INVALID_REFERENCE;
+        IfJsErrorThrow(JsConstructObject(m_errorConstructor.Get(), &undefined, 1, &error));
+
+        String16 stack;
+        if (!PropertyHelpers::TryGetProperty(error, PropertyHelpers::Names::Stack, &stack))
+        {
+            return frames;
+        }
+
+        // The first line is the error message, each following line is a frame.
+        std::istringstream lines(stack.toUtf8());
+        std::string line;
+        std::getline(lines, line);
+
+        while (frames.size() < c_MaxFramesPerStack && std::getline(lines, line))
+        {
+            Frame frame;
+            if (TryParseFrame(line, &frame))
+            {
+                frames.push_back(frame);
+            }
+        }
+
+        return frames;
+    }
+
+    bool AsyncStackRecorder::TryParseFrame(const std::string& line, Frame* frame)
+    {
+        // Frames have the form "   at functionName (url:line:column)" or "   at url:line:column".
+        size_t start = line.find(c_FramePrefix);
+        if (start == std::string::npos)
+        {
+            return false;
+        }
+
+        start += sizeof(c_FramePrefix) - 1;
+
+        size_t end = line.find_last_not_of(" \t\r");
+        if (end == std::string::npos || end < start)
+        {
+            return false;
+        }
+
+        std::string functionName;
+        std::string location = line.substr(start, end - start + 1);
+
+        size_t openParen = location.rfind(" (");
+        if (location.back() == ')' && openParen != std::string::npos)
+        {
+            functionName = location.substr(0, openParen);
+            location = location.substr(openParen + 2, location.length() - openParen - 3);
+        }
+
+        size_t columnSeparator = location.rfind(':');
+        if (columnSeparator == std::string::npos || columnSeparator == 0)
+        {
+            return false;
+        }
+
+        size_t lineSeparator = location.rfind(':', columnSeparator - 1);
+        if (lineSeparator == std::string::npos)
+        {
+            return false;
+        }
+
+        // Stack traces are 1-based while the protocol is 0-based.
+        frame->line = std::atoi(location.c_str() + lineSeparator + 1) - 1;
+        frame->column = std::atoi(location.c_str() + columnSeparator + 1) - 1;
+        frame->url = Intern(location.substr(0, lineSeparator));
+        frame->functionName = Intern(functionName);
+
+        return true;
+    }
+
+    void AsyncStackRecorder::Clear()
+    {
+        m_records.clear();
+        m_records.shrink_to_fit();
+        m_stacks.clear();
+        m_freeStacks.clear();
+        m_stackLookup.clear();
+        m_taskLookup.clear();
+        m_runningTasks.clear();
+
+        m_atoms.clear();
+        m_atoms.shrink_to_fit();
+        m_freeAtoms.clear();
+        m_atomLookup.clear();
+    }
+}
@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "JsPersistent.h"
+
+#include <protocol/Runtime.h>
+#include <ChakraCore.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace JsDebug
+{
+    class Debugger;
+
+    // Records the call stack at the point each asynchronous task is scheduled, so that it can be reported as the async
+    // stack trace when the debugger pauses while the task is running. Task records live in a fixed-size ring buffer and
+    // the oldest ones are overwritten once it is full. Identical stacks are stored once and shared between tasks, as
+    // are the strings they refer to, and both are freed along with the last record that uses them.
+    //
+    // The engine only reports the stack through its diagnostics API while at a break, so the stack is read from a new
+    // Error object instead. That costs about as much as script doing the same, once per scheduled task, and the number
+    // of frames is limited by Error.stackTraceLimit.
+    class AsyncStackRecorder
+    {
+    public:
+        explicit AsyncStackRecorder(Debugger* debugger);
+        AsyncStackRecorder(const AsyncStackRecorder&) = delete;
+        AsyncStackRecorder& operator=(const AsyncStackRecorder&) = delete;
+
+        int GetMaxDepth() const;
+        void SetMaxDepth(int maxDepth);
+
+        void TaskScheduled(void* task, const char* description);
+        void TaskStarted(void* task);
+        void TaskFinished(void* task);
+
+        // Returns null if there is no recorded async stack for the currently running task.
+        std::unique_ptr<protocol::Runtime::StackTrace> GetAsyncStackTrace();
+
+    private:
+        struct Frame
+        {
+            int url;
+            int line;
+            int column;
+            int functionName;
+
+            bool operator==(const Frame& other) const;
+        };
+
+        struct Stack
+        {
+            std::vector<Frame> frames;
+            size_t hash;
+            int refCount;
+        };
+
+        struct TaskRecord
+        {
+            void* task;
+            uint64_t sequence;
+            uint64_t parent;
+            int stack;
+            int description;
+        };
+
+        struct Atom
+        {
+            std::string value;
+            int refCount;
+        };
+
+        // Each call adds a reference to the returned atom, which must be released once it's no longer used.
+        int Intern(const std::string& str);
+        void ReleaseAtom(int atom);
+        void ReleaseFrames(const std::vector<Frame>& frames);
+        int InternStack(std::vector<Frame>&& frames);
+        void ReleaseStack(int stack);
+        void EvictRecord(TaskRecord& record);
+        const TaskRecord* FindRecord(uint64_t sequence) const;
+        std::vector<Frame> CaptureFrames();
+        bool TryParseFrame(const std::string& line, Frame* frame);
+        void Clear();
+
+        Debugger* m_debugger;
+        JsPersistent m_errorConstructor;
+        int m_maxDepth;
+
+        std::vector<Atom> m_atoms;
+        std::vector<int> m_freeAtoms;
+        std::unordered_map<std::string, int> m_atomLookup;
+
+        std::vector<Stack> m_stacks;
+        std::vector<int> m_freeStacks;
+        std::unordered_multimap<size_t, int> m_stackLookup;
+
+        std::vector<TaskRecord> m_records;
+        uint64_t m_nextSequence;
+        std::unordered_map<void*, uint64_t> m_taskLookup;
+        std::vector<uint64_t> m_runningTasks;
+    };
+}
@@ -4,6 +4,7 @@
 #include "stdafx.h"
 #include "ChakraDebugProtocolHandler.h"
 #include "ProtocolHandler.h"
+#include "TimeTravelStreams.h"
 #include "TranslateExceptionToJsErrorCode.h"
 
 CHAKRA_API JsDebugProtocolHandlerCreate(JsRuntimeHandle runtime, JsDebugProtocolHandler* protocolHandler)
@@ -78,6 +79,41 @@ CHAKRA_API JsDebugProtocolHandlerWaitForDebugger(JsDebugProtocolHandler protocol
         });
 }
 
+CHAKRA_API JsDebugProtocolHandlerWaitForDebuggerWithTimeout(
+    JsDebugProtocolHandler protocolHandler,
+    unsigned int timeoutMilliseconds,
+    bool* timedOut)
+{
+    if (timedOut == nullptr)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    return JsDebug::TranslateExceptionToJsErrorCode<JsDebug::ProtocolHandler*>(
+        protocolHandler,
+        [&](JsDebug::ProtocolHandler* instance) -> void
+        {
+            *timedOut = !instance->WaitForDebugger(std::chrono::milliseconds(timeoutMilliseconds));
+        });
+}
+
+CHAKRA_API JsDebugProtocolHandlerGetCommandWaitHandle(
+    JsDebugProtocolHandler protocolHandler,
+    JsDebugWaitHandle* waitHandle)
+{
+    if (waitHandle == nullptr)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    return JsDebug::TranslateExceptionToJsErrorCode<JsDebug::ProtocolHandler*>(
+        protocolHandler,
+        [&](JsDebug::ProtocolHandler* instance) -> void
+        {
+            *waitHandle = instance->GetCommandWaitHandle();
+        });
+}
+
 CHAKRA_API JsDebugProtocolHandlerProcessCommandQueue(JsDebugProtocolHandler protocolHandler)
 {
     return JsDebug::TranslateExceptionToJsErrorCode<JsDebug::ProtocolHandler*>(
@@ -88,6 +124,27 @@ CHAKRA_API JsDebugProtocolHandlerProcessCommandQueue(JsDebugProtocolHandler prot
         });
 }
 
+CHAKRA_API JsDebugProtocolHandlerProcessCommandQueueWithBudget(
+    JsDebugProtocolHandler protocolHandler,
+    size_t maxCommands,
+    unsigned int timeBudgetMilliseconds,
+    size_t* remainingCommands)
+{
+    if (remainingCommands == nullptr)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    return JsDebug::TranslateExceptionToJsErrorCode<JsDebug::ProtocolHandler*>(
+        protocolHandler,
+        [&](JsDebug::ProtocolHandler* instance) -> void
+        {
+            *remainingCommands = instance->ProcessCommandQueue(
+                maxCommands,
+                std::chrono::milliseconds(timeBudgetMilliseconds));
+        });
+}
+
 CHAKRA_API JsDebugProtocolHandlerSetCommandQueueCallback(
     JsDebugProtocolHandler protocolHandler,
     JsDebugProtocolHandlerCommandQueueCallback callback,
@@ -113,3 +170,68 @@ CHAKRA_API JsDebugProtocolHandlerCreateConsoleObject(
         *consoleObject = instance->CreateConsoleObject();
     });
 }
+
+CHAKRA_API JsDebugProtocolHandlerAsyncTaskScheduled(
+    JsDebugProtocolHandler protocolHandler,
+    void* task,
+    const char* description)
+{
+    return JsDebug::TranslateExceptionToJsErrorCode<JsDebug::ProtocolHandler*>(
+        protocolHandler,
+        [&](JsDebug::ProtocolHandler* instance) -> void
+        {
+            instance->AsyncTaskScheduled(task, description);
+        });
+}
+
+CHAKRA_API JsDebugProtocolHandlerAsyncTaskStarted(JsDebugProtocolHandler protocolHandler, void* task)
+{
+    return JsDebug::TranslateExceptionToJsErrorCode<JsDebug::ProtocolHandler*>(
+        protocolHandler,
+        [&](JsDebug::ProtocolHandler* instance) -> void
+        {
+            instance->AsyncTaskStarted(task);
+        });
+}
+
+CHAKRA_API JsDebugProtocolHandlerAsyncTaskFinished(JsDebugProtocolHandler protocolHandler, void* task)
+{
+    return JsDebug::TranslateExceptionToJsErrorCode<JsDebug::ProtocolHandler*>(
+        protocolHandler,
+        [&](JsDebug::ProtocolHandler* instance) -> void
+        {
+            instance->AsyncTaskFinished(task);
+        });
+}
+
+CHAKRA_API JsDebugProtocolHandlerSetTimeTravelReplay(JsDebugProtocolHandler protocolHandler, bool isReplay)
+{
+    return JsDebug::TranslateExceptionToJsErrorCode<JsDebug::ProtocolHandler*>(
+        protocolHandler,
+        [&](JsDebug::ProtocolHandler* instance) -> void
+        {
+            instance->SetTimeTravelReplay(isReplay);
+        });
+}
+
+CHAKRA_API JsDebugProtocolHandlerGetTTDFileStreamCallbacks(
+    TTDOpenResourceStreamCallback* openResourceStream,
+    JsTTDReadBytesFromStreamCallback* readBytesFromStream,
+    JsTTDWriteBytesToStreamCallback* writeBytesToStream,
+    JsTTDFlushAndCloseStreamCallback* flushAndCloseStream)
+{
+    if (openResourceStream == nullptr ||
+        readBytesFromStream == nullptr ||
+        writeBytesToStream == nullptr ||
+        flushAndCloseStream == nullptr)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    *openResourceStream = &JsDebug::TimeTravelStreams::OpenResourceStream;
+    *readBytesFromStream = &JsDebug::TimeTravelStreams::ReadBytesFromStream;
+    *writeBytesToStream = &JsDebug::TimeTravelStreams::WriteBytesToStream;
+    *flushAndCloseStream = &JsDebug::TimeTravelStreams::FlushAndCloseStream;
+
+    return JsNoError;
+}
@@ -11,6 +11,12 @@ typedef void(CHAKRA_CALLBACK* JsDebugProtocolHandlerSendResponseCallback)(
     _In_opt_ void* callbackState);
 typedef void(CHAKRA_CALLBACK* JsDebugProtocolHandlerCommandQueueCallback)(_In_opt_ void* callbackState);
 
+#ifdef _WIN32
+typedef void* JsDebugWaitHandle;
+#else
+typedef int JsDebugWaitHandle;
+#endif
+
 /// <summary>Creates a <seealso cref="JsDebugProtocolHandler" /> instance for a given runtime.</summary>
 /// <remarks>
 ///     It also implicitly enables debugging on the given runtime, so it will need to only be done when the engine is
@@ -67,6 +73,32 @@ CHAKRA_API JsDebugProtocolHandlerSendCommand(_In_ JsDebugProtocolHandler protoco
 /// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
 CHAKRA_API JsDebugProtocolHandlerWaitForDebugger(_In_ JsDebugProtocolHandler protocolHandler);
 
+/// <summary>Blocks the current thread until the debugger has connected or the timeout has elapsed.</summary>
+/// <remarks>
+///     This must be called from the script thread. Commands that arrive while waiting are processed as usual.
+/// </remarks>
+/// <param name="protocolHandler">The instance to wait on.</param>
+/// <param name="timeoutMilliseconds">The maximum time to wait, in milliseconds.</param>
+/// <param name="timedOut">Set to true if the timeout elapsed before the debugger asked the runtime to run.</param>
+/// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
+CHAKRA_API JsDebugProtocolHandlerWaitForDebuggerWithTimeout(
+    _In_ JsDebugProtocolHandler protocolHandler,
+    _In_ unsigned int timeoutMilliseconds,
+    _Out_ bool* timedOut);
+
+/// <summary>Gets a handle that is signaled while commands are waiting in the queue.</summary>
+/// <remarks>
+///     On Windows this is a manual-reset event that can be passed to the wait functions, elsewhere it is an eventfd
+///     that becomes readable and can be added to poll, epoll or select. The handle is reset when the queue is
+///     processed, and it is owned by the protocol handler so it must not be closed or read from by the host.
+/// </remarks>
+/// <param name="protocolHandler">The instance to get the handle for.</param>
+/// <param name="waitHandle">The wait handle.</param>
+/// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
+CHAKRA_API JsDebugProtocolHandlerGetCommandWaitHandle(
+    _In_ JsDebugProtocolHandler protocolHandler,
+    _Out_ JsDebugWaitHandle* waitHandle);
+
 /// <summary>Processes any commands in the queue.</summary>
 /// <remarks>
 ///     This must be called from the script thread.
@@ -75,6 +107,25 @@ CHAKRA_API JsDebugProtocolHandlerWaitForDebugger(_In_ JsDebugProtocolHandler pro
 /// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
 CHAKRA_API JsDebugProtocolHandlerProcessCommandQueue(_In_ JsDebugProtocolHandler protocolHandler);
 
+/// <summary>Processes commands in the queue until the queue is empty or the budget is used up.</summary>
+/// <remarks>
+///     This must be called from the script thread. Unlike <c>JsDebugProtocolHandlerProcessCommandQueue</c> it never
+///     waits for new commands. At least one command is processed if any are queued and <c>maxCommands</c> is not zero.
+///     A command that causes the runtime to break still waits for the debugger to resume it. If any commands are left,
+///     another async break is requested and the command wait handle stays signaled, but the command queue callback is
+///     not called again for them.
+/// </remarks>
+/// <param name="protocolHandler">The instance to process.</param>
+/// <param name="maxCommands">The maximum number of commands to process.</param>
+/// <param name="timeBudgetMilliseconds">The time after which no further commands are started, in milliseconds.</param>
+/// <param name="remainingCommands">The number of commands that are still queued.</param>
+/// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
+CHAKRA_API JsDebugProtocolHandlerProcessCommandQueueWithBudget(
+    _In_ JsDebugProtocolHandler protocolHandler,
+    _In_ size_t maxCommands,
+    _In_ unsigned int timeBudgetMilliseconds,
+    _Out_ size_t* remainingCommands);
+
 /// <summary>Registers a callback that notifies the host of any commands added to the queue.</summary>
 /// <remarks>
 ///     This must be called from the script thread, but the callback can be called from any thread.
@@ -95,3 +146,64 @@ CHAKRA_API JsDebugProtocolHandlerCreateConsoleObject(
     _In_ JsDebugProtocolHandler protocolHandler,
     _Out_ JsValueRef *consoleObject
 );
+
+/// <summary>Notifies the debugger that an asynchronous task, such as a promise continuation, has been scheduled.</summary>
+/// <remarks>
+///     This must be called from the script thread. The current call stack is recorded only while an async call stack
+///     depth has been set by the debugger, otherwise the call returns immediately. Recording the stack creates an
+///     <c>Error</c> object and reads its <c>stack</c> property, which costs about as much as doing the same from script,
+///     and keeps at most <c>Error.stackTraceLimit</c> frames.
+/// </remarks>
+/// <param name="protocolHandler">The instance to notify.</param>
+/// <param name="task">An identifier for the task, which must be unique among the tasks that haven't finished.</param>
+/// <param name="description">An optional description of the task shown in the async call stack.</param>
+/// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
+CHAKRA_API JsDebugProtocolHandlerAsyncTaskScheduled(
+    _In_ JsDebugProtocolHandler protocolHandler,
+    _In_ void* task,
+    _In_opt_z_ const char* description);
+
+/// <summary>Notifies the debugger that a previously scheduled asynchronous task has started running.</summary>
+/// <remarks>
+///     This must be called from the script thread.
+/// </remarks>
+/// <param name="protocolHandler">The instance to notify.</param>
+/// <param name="task">The identifier passed to <c>JsDebugProtocolHandlerAsyncTaskScheduled</c>.</param>
+/// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
+CHAKRA_API JsDebugProtocolHandlerAsyncTaskStarted(_In_ JsDebugProtocolHandler protocolHandler, _In_ void* task);
+
+/// <summary>Notifies the debugger that a running asynchronous task has finished.</summary>
+/// <remarks>
+///     This must be called from the script thread.
+/// </remarks>
+/// <param name="protocolHandler">The instance to notify.</param>
+/// <param name="task">The identifier passed to <c>JsDebugProtocolHandlerAsyncTaskStarted</c>.</param>
+/// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
+CHAKRA_API JsDebugProtocolHandlerAsyncTaskFinished(_In_ JsDebugProtocolHandler protocolHandler, _In_ void* task);
+
+/// <summary>Tells the debugger whether the runtime is replaying a time-travel debugging log.</summary>
+/// <remarks>
+///     This must be called from the script thread. Hosts that create the runtime with <c>JsTTDCreateReplayRuntime</c>
+///     should set this, since <c>TimeTravel.stepBack</c> and <c>TimeTravel.reverse</c> are rejected otherwise.
+/// </remarks>
+/// <param name="protocolHandler">The instance to update.</param>
+/// <param name="isReplay">Whether the runtime is replaying a log.</param>
+/// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
+CHAKRA_API JsDebugProtocolHandlerSetTimeTravelReplay(_In_ JsDebugProtocolHandler protocolHandler, _In_ bool isReplay);
+
+/// <summary>Gets stream callbacks that read and write time-travel debugging logs as files on disk.</summary>
+/// <remarks>
+///     Pass these to <c>JsTTDCreateRecordRuntime</c> or <c>JsTTDCreateReplayRuntime</c>. The uri given to
+///     <c>TimeTravel.writeTTDLog</c> is then treated as a directory, and the log is streamed to files within it instead
+///     of being held in memory.
+/// </remarks>
+/// <param name="openResourceStream">The callback that opens a log resource.</param>
+/// <param name="readBytesFromStream">The callback that reads from an open log resource.</param>
+/// <param name="writeBytesToStream">The callback that writes to an open log resource.</param>
+/// <param name="flushAndCloseStream">The callback that flushes and closes a log resource.</param>
+/// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
+CHAKRA_API JsDebugProtocolHandlerGetTTDFileStreamCallbacks(
+    _Out_ TTDOpenResourceStreamCallback* openResourceStream,
+    _Out_ JsTTDReadBytesFromStreamCallback* readBytesFromStream,
+    _Out_ JsTTDWriteBytesToStreamCallback* writeBytesToStream,
+    _Out_ JsTTDFlushAndCloseStreamCallback* flushAndCloseStream);
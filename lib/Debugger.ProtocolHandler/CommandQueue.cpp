@@ -0,0 +1,217 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+#include "CommandQueue.h"
+
+namespace JsDebug
+{
+    namespace
+    {
+        // Pooled messages keep their buffer for reuse, unless it grew past this size or the buffers kept by the pool
+        // would add up to more than the total.
+        const size_t c_MaxRetainedMessageCapacity = 64 * 1024;
+        const size_t c_MaxRetainedBytes = 4 * 1024 * 1024;
+
+        const uint64_t c_FreeIndexMask = 0xFFFFFFFFull;
+
+        template <typename Node>
+        void DeleteUnpooled(Node* node)
+        {
+            while (node != nullptr)
+            {
+                Node* next = node->next;
+                if (!node->isPooled)
+                {
+                    delete node;
+                }
+
+                node = next;
+            }
+        }
+
+        // Short strings are stored inline, so only the capacity of a separate buffer counts towards the total.
+        size_t GetBufferSize(const std::string& message)
+        {
+            static const size_t inlineCapacity = std::string().capacity();
+            return message.capacity() > inlineCapacity ? message.capacity() : 0;
+        }
+
+        uint64_t MakeFreeHead(uint64_t previous, uint32_t indexPlusOne)
+        {
+            uint64_t tag = (previous >> 32) + 1;
+            return (tag << 32) | indexPlusOne;
+        }
+    }
+
+    CommandQueue::CommandQueue()
+        : m_head(nullptr)
+        , m_pending(nullptr)
+        , m_size(0)
+        , m_freeHead(0)
+        , m_chunks(new std::atomic<Node*>[c_MaxChunks])
+        , m_chunkCount(0)
+        , m_retainedBytes(0)
+    {
+        for (uint32_t i = 0; i < c_MaxChunks; ++i)
+        {
+            m_chunks[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    CommandQueue::~CommandQueue()
+    {
+        DeleteUnpooled(m_head.exchange(nullptr));
+        DeleteUnpooled(m_pending);
+
+        for (uint32_t i = 0; i < c_MaxChunks; ++i)
+        {
+            delete[] m_chunks[i].load();
+        }
+    }
+
+    bool CommandQueue::Push(CommandType type, int session, const char* message)
+    {
+        Node* node = AcquireNode();
+        m_retainedBytes.fetch_sub(GetBufferSize(node->message), std::memory_order_relaxed);
+
+        node->type = type;
+        node->session = session;
+        node->message.assign(message);
+
+        m_size.fetch_add(1, std::memory_order_relaxed);
+
+        Node* head = m_head.load(std::memory_order_relaxed);
+        do
+        {
+            node->next = head;
+        } while (!m_head.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+
+        return head == nullptr;
+    }
+
+    bool CommandQueue::IsEmpty() const
+    {
+        return m_head.load(std::memory_order_acquire) == nullptr && m_pending == nullptr;
+    }
+
+    size_t CommandQueue::GetSize() const
+    {
+        return m_size.load(std::memory_order_relaxed);
+    }
+
+    CommandQueue::Node* CommandQueue::TakeAll()
+    {
+        Node* node = m_head.exchange(nullptr, std::memory_order_acquire);
+
+        // The stack is newest first, so reverse it to process commands in the order they arrived.
+        Node* ordered = nullptr;
+        while (node != nullptr)
+        {
+            Node* next = node->next;
+            node->next = ordered;
+            ordered = node;
+            node = next;
+        }
+
+        return ordered;
+    }
+
+    CommandQueue::Node* CommandQueue::AcquireNode()
+    {
+        uint64_t head = m_freeHead.load(std::memory_order_acquire);
+
+        while ((head & c_FreeIndexMask) != 0)
+        {
+            Node* node = NodeAt(static_cast<uint32_t>(head & c_FreeIndexMask) - 1);
+            uint32_t next = node->nextFree.load(std::memory_order_relaxed);
+
+            if (m_freeHead.compare_exchange_weak(
+                head,
+                MakeFreeHead(head, next),
+                std::memory_order_acq_rel,
+                std::memory_order_acquire))
+            {
+                return node;
+            }
+        }
+
+        return AllocateChunk();
+    }
+
+    CommandQueue::Node* CommandQueue::AllocateChunk()
+    {
+        uint32_t chunk = c_MaxChunks;
+        if (m_chunkCount.load(std::memory_order_relaxed) < c_MaxChunks)
+        {
+            chunk = m_chunkCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (chunk >= c_MaxChunks)
+        {
+            // The pool is exhausted, fall back to an individual allocation that is freed once handled.
+            Node* node = new Node();
+            node->next = nullptr;
+            node->nextFree.store(0, std::memory_order_relaxed);
+            node->index = 0;
+            node->isPooled = false;
+            node->type = CommandType::None;
+            return node;
+        }
+
+        Node* nodes = new Node[c_NodesPerChunk];
+        for (uint32_t i = 0; i < c_NodesPerChunk; ++i)
+        {
+            nodes[i].next = nullptr;
+            nodes[i].index = chunk * c_NodesPerChunk + i;
+            nodes[i].isPooled = true;
+            nodes[i].type = CommandType::None;
+            nodes[i].nextFree.store(
+                i + 1 < c_NodesPerChunk ? nodes[i].index + 2 : 0,
+                std::memory_order_relaxed);
+        }
+
+        m_chunks[chunk].store(nodes, std::memory_order_release);
+
+        // Keep the first node and make the rest of the chunk available to other producers.
+        PushFree(&nodes[1], &nodes[c_NodesPerChunk - 1]);
+        return &nodes[0];
+    }
+
+    void CommandQueue::ReleaseNode(Node* node)
+    {
+        if (!node->isPooled)
+        {
+            delete node;
+            return;
+        }
+
+        size_t bufferSize = GetBufferSize(node->message);
+        if (bufferSize > c_MaxRetainedMessageCapacity ||
+            m_retainedBytes.load(std::memory_order_relaxed) + bufferSize > c_MaxRetainedBytes)
+        {
+            std::string().swap(node->message);
+            bufferSize = 0;
+        }
+
+        m_retainedBytes.fetch_add(bufferSize, std::memory_order_relaxed);
+        PushFree(node, node);
+    }
+
+    void CommandQueue::PushFree(Node* first, Node* last)
+    {
+        uint64_t head = m_freeHead.load(std::memory_order_relaxed);
+        uint64_t newHead = 0;
+
+        do
+        {
+            last->nextFree.store(static_cast<uint32_t>(head & c_FreeIndexMask), std::memory_order_relaxed);
+            newHead = MakeFreeHead(head, first->index + 1);
+        } while (!m_freeHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    CommandQueue::Node* CommandQueue::NodeAt(uint32_t index) const
+    {
+        return &m_chunks[index / c_NodesPerChunk].load(std::memory_order_acquire)[index % c_NodesPerChunk];
+    }
+}
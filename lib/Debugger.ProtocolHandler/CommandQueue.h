@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace JsDebug
+{
+    enum class CommandType
+    {
+        None,
+        Connect,
+        Disconnect,
+        MessageReceived,
+    };
+
+    // Lock-free queue with any number of producers and a single consumer. Producers push onto an intrusive stack with a
+    // single compare-and-swap, and the consumer takes the whole stack at once and reverses it into arrival order.
+    // Nodes are pooled so that steady-state traffic doesn't allocate, and pooled messages keep their string capacity up
+    // to a limit on the total, so that a burst of large commands doesn't stay allocated.
+    class CommandQueue
+    {
+    public:
+        CommandQueue();
+        ~CommandQueue();
+        CommandQueue(const CommandQueue&) = delete;
+        CommandQueue& operator=(const CommandQueue&) = delete;
+
+        // Returns true if the queue was empty before this command was added, which is the only time the consumer
+        // needs to be woken up. The session identifies the connection the command belongs to.
+        bool Push(CommandType type, int session, const char* message = "");
+
+        // Must only be called from the consumer thread.
+        bool IsEmpty() const;
+
+        // Approximate number of commands that are queued or taken but not yet handled.
+        size_t GetSize() const;
+
+        // Calls the handler for every queued command in the order they were pushed and returns the number handled.
+        // Must only be called from the consumer thread.
+        template <typename Handler>
+        size_t Drain(Handler&& handler)
+        {
+            return Drain(std::forward<Handler>(handler), []() { return true; });
+        }
+
+        // Like Drain, but checks the predicate before each command and stops as soon as it returns false. Commands that
+        // were taken but not handled stay at the front of the queue for the next call. A nested call made from a handler
+        // continues with the same commands, so they are still handled in order.
+        template <typename Handler, typename Predicate>
+        size_t Drain(Handler&& handler, Predicate&& canContinue)
+        {
+            if (m_pending == nullptr)
+            {
+                m_pending = TakeAll();
+            }
+
+            size_t count = 0;
+
+            while (m_pending != nullptr && canContinue())
+            {
+                Node* node = m_pending;
+                m_pending = node->next;
+                m_size.fetch_sub(1, std::memory_order_relaxed);
+
+                try
+                {
+                    handler(node->type, node->session, node->message);
+                }
+                catch (...)
+                {
+                    ReleaseNode(node);
+                    throw;
+                }
+
+                ReleaseNode(node);
+                ++count;
+            }
+
+            return count;
+        }
+
+    private:
+        struct Node
+        {
+            Node* next;
+            std::atomic<uint32_t> nextFree;
+            uint32_t index;
+            bool isPooled;
+            CommandType type;
+            int session;
+            std::string message;
+        };
+
+        static const uint32_t c_NodesPerChunk = 64;
+        static const uint32_t c_MaxChunks = 1024;
+
+        Node* TakeAll();
+        Node* AcquireNode();
+        Node* AllocateChunk();
+        void ReleaseNode(Node* node);
+        void PushFree(Node* first, Node* last);
+        Node* NodeAt(uint32_t index) const;
+
+        // Pushed commands, newest first.
+        std::atomic<Node*> m_head;
+
+        // Commands taken by the consumer but not handled yet, oldest first. Only touched by the consumer thread.
+        Node* m_pending;
+        std::atomic<size_t> m_size;
+
+        // Free list of pooled nodes. The low 32 bits hold the index of the first node plus one (zero when empty) and
+        // the high 32 bits hold a tag that changes on every update so a stale compare-and-swap can't succeed.
+        std::atomic<uint64_t> m_freeHead;
+
+        // Chunks are never freed before the queue is destroyed, so a producer can always safely read a node it found
+        // on the free list even if another producer took it first.
+        std::unique_ptr<std::atomic<Node*>[]> m_chunks;
+        std::atomic<uint32_t> m_chunkCount;
+
+        // Total string capacity held by the messages of nodes on the free list.
+        std::atomic<size_t> m_retainedBytes;
+    };
+}
@@ -0,0 +1,89 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+#include "CommandWaitHandle.h"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cstdint>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+namespace JsDebug
+{
+    namespace
+    {
+        const char c_ErrorCreateWaitHandle[] = "Unable to create the command wait handle";
+    }
+
+    CommandWaitHandle::CommandWaitHandle()
+        : m_isSignaled(false)
+    {
+#ifdef _WIN32
+        m_handle = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        if (m_handle == nullptr)
+        {
+            throw std::runtime_error(c_ErrorCreateWaitHandle);
+        }
+#else
+        m_handle = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (m_handle == -1)
+        {
+            throw std::runtime_error(c_ErrorCreateWaitHandle);
+        }
+#endif
+    }
+
+    CommandWaitHandle::~CommandWaitHandle()
+    {
+#ifdef _WIN32
+        CloseHandle(m_handle);
+#else
+        close(m_handle);
+#endif
+    }
+
+    JsDebugWaitHandle CommandWaitHandle::GetHandle() const
+    {
+        return m_handle;
+    }
+
+    void CommandWaitHandle::Signal()
+    {
+        if (m_isSignaled.exchange(true))
+        {
+            return;
+        }
+
+#ifdef _WIN32
+        SetEvent(m_handle);
+#else
+        uint64_t value = 1;
+        (void)write(m_handle, &value, sizeof(value));
+#endif
+    }
+
+    void CommandWaitHandle::Reset()
+    {
+        if (!m_isSignaled.load())
+        {
+            return;
+        }
+
+        // Reset the handle before clearing the flag. A producer that finds the flag still set has already queued its
+        // command, so the caller will pick it up when it takes the queue.
+#ifdef _WIN32
+        ResetEvent(m_handle);
+#else
+        uint64_t value = 0;
+        (void)read(m_handle, &value, sizeof(value));
+#endif
+
+        m_isSignaled = false;
+    }
+}
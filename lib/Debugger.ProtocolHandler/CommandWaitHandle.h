@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ChakraDebugProtocolHandler.h"
+
+#include <atomic>
+
+namespace JsDebug
+{
+    // An OS handle that is signaled while commands are queued, so that hosts can wait on it alongside their other I/O.
+    // On Windows this is a manual-reset event, elsewhere it is a non-blocking eventfd that is readable while signaled.
+    class CommandWaitHandle
+    {
+    public:
+        CommandWaitHandle();
+        ~CommandWaitHandle();
+        CommandWaitHandle(const CommandWaitHandle&) = delete;
+        CommandWaitHandle& operator=(const CommandWaitHandle&) = delete;
+
+        JsDebugWaitHandle GetHandle() const;
+
+        // Can be called from any thread, and only touches the OS handle if it isn't already signaled.
+        void Signal();
+
+        // Must only be called from the consumer thread, before it takes the queued commands.
+        void Reset();
+
+    private:
+        JsDebugWaitHandle m_handle;
+        std::atomic<bool> m_isSignaled;
+    };
+}
@@ -4,15 +4,12 @@
 #include "stdafx.h"
 #include "ConsoleImpl.h"
 
+#include "ProtocolHandler.h"
+
 namespace JsDebug
 {
     using protocol::Response;
 
-    namespace
-    {
-        const char c_ErrorNotImplemented[] = "Not implemented";
-    }
-
     ConsoleImpl::ConsoleImpl(ProtocolHandler* handler, protocol::FrontendChannel* frontendChannel)
         : m_handler(handler)
         , m_frontend(frontendChannel)
@@ -35,6 +32,7 @@ namespace JsDebug
 
     Response ConsoleImpl::clearMessages()
     {
-        return Response::Error(c_ErrorNotImplemented);
+        m_handler->ClearConsoleMessages();
+        return Response::OK();
     }
 }
\ No newline at end of file
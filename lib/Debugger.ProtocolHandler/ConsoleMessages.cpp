@@ -0,0 +1,172 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+#include "ConsoleMessages.h"
+
+#include "ProtocolHelpers.h"
+
+#include <cassert>
+
+namespace JsDebug
+{
+    using protocol::Array;
+    using protocol::DictionaryValue;
+    using protocol::Runtime::RemoteObject;
+    using protocol::String;
+    using protocol::StringBuilder;
+    using protocol::StringUtil;
+
+    namespace
+    {
+        const int c_MaxStringLength = 1000;
+        const char c_ObjectIdKey[] = "objectId";
+    }
+
+    ConsoleMessages::ConsoleMessages(size_t capacity, size_t maxMessageLength, int executionContextId)
+        : m_maxMessageLength(maxMessageLength)
+        , m_executionContextId(executionContextId)
+        , m_timestamp(1)
+        , m_messages(capacity)
+        , m_next(0)
+        , m_count(0)
+    {
+        assert(capacity > 0);
+    }
+
+    void ConsoleMessages::Add(const String& type, const JsValueRef* arguments, size_t argumentCount)
+    {
+        // Wrapping stops once the message is full, as the rest wouldn't be kept anyway.
+        std::vector<String> args;
+        size_t length = 0;
+        for (size_t i = 1; i < argumentCount && length <= m_maxMessageLength; i++)
+        {
+            args.push_back(ProtocolHelpers::WrapValueSummary(arguments[i], c_MaxStringLength)->serialize());
+            length += args.back().length();
+        }
+
+        Keep(type, args);
+    }
+
+    void ConsoleMessages::Add(const String& type, Array<RemoteObject>& args, String* notification)
+    {
+        std::vector<String> liveArgs;
+        std::vector<String> keptArgs;
+        liveArgs.reserve(args.length());
+        keptArgs.reserve(args.length());
+
+        for (size_t i = 0; i < args.length(); i++)
+        {
+            RemoteObject* arg = args.get(i);
+            liveArgs.push_back(arg->serialize());
+
+            if (arg->hasObjectId())
+            {
+                std::unique_ptr<DictionaryValue> value = arg->toValue();
+                value->remove(c_ObjectIdKey);
+                keptArgs.push_back(value->serialize());
+            }
+            else
+            {
+                keptArgs.push_back(liveArgs.back());
+            }
+        }
+
+        // The live notification uses the same timestamp as the kept message, so that a frontend can match them up.
+        double timestamp = Keep(type, keptArgs);
+        *notification = BuildNotification(type, liveArgs, timestamp);
+    }
+
+    double ConsoleMessages::Keep(const String& type, const std::vector<String>& args)
+    {
+        // TODO : to get the correct timestamp.
+        double timestamp = m_timestamp++;
+
+        // Arguments are kept only while they fit, so a message with many long strings still takes a bounded amount of
+        // space.
+        size_t count = 0;
+        size_t length = 0;
+        while (count < args.size() && length + args[count].length() <= m_maxMessageLength)
+        {
+            length += args[count].length();
+            ++count;
+        }
+
+        if (count == args.size())
+        {
+            m_messages[m_next] = BuildNotification(type, args, timestamp);
+        }
+        else
+        {
+            std::vector<String> keptArgs(args.begin(), args.begin() + count);
+            m_messages[m_next] = BuildNotification(type, keptArgs, timestamp);
+        }
+
+        m_next = (m_next + 1) % m_messages.size();
+        if (m_count < m_messages.size())
+        {
+            ++m_count;
+        }
+
+        return timestamp;
+    }
+
+    String ConsoleMessages::BuildNotification(
+        const String& type,
+        const std::vector<String>& args,
+        double timestamp) const
+    {
+        // Built from the serialized arguments, laid out as the generated Runtime.consoleAPICalled notification is.
+        StringBuilder builder;
+        StringUtil::builderAppend(builder, "{\"method\":\"Runtime.consoleAPICalled\",\"params\":{\"type\":");
+        StringUtil::builderAppendQuotedString(builder, type);
+        StringUtil::builderAppend(builder, ",\"args\":[");
+
+        for (size_t i = 0; i < args.size(); i++)
+        {
+            if (i > 0)
+            {
+                StringUtil::builderAppend(builder, ",");
+            }
+
+            StringUtil::builderAppend(builder, args[i]);
+        }
+
+        StringUtil::builderAppend(builder, "],\"executionContextId\":");
+        StringUtil::builderAppend(builder, StringUtil::fromInteger(m_executionContextId));
+        StringUtil::builderAppend(builder, ",\"timestamp\":");
+        StringUtil::builderAppend(builder, StringUtil::fromDouble(timestamp));
+        StringUtil::builderAppend(builder, "}}");
+
+        return StringUtil::builderToString(builder);
+    }
+
+    void ConsoleMessages::Replay(protocol::FrontendChannel* frontendChannel) const
+    {
+        size_t capacity = m_messages.size();
+        size_t first = (m_next + capacity - m_count) % capacity;
+
+        for (size_t i = 0; i < m_count; i++)
+        {
+            frontendChannel->sendProtocolNotification(
+                protocol::SerializedValue::create(m_messages[(first + i) % capacity]));
+        }
+    }
+
+    void ConsoleMessages::Clear()
+    {
+        // Only the strings are released. The slots stay so that recording never has to grow the ring.
+        for (auto& message : m_messages)
+        {
+            message = String();
+        }
+
+        m_next = 0;
+        m_count = 0;
+    }
+
+    size_t ConsoleMessages::GetMessageCount() const
+    {
+        return m_count;
+    }
+}
@@ -0,0 +1,58 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <protocol/Forward.h>
+#include <protocol/Runtime.h>
+#include <ChakraCore.h>
+
+#include <vector>
+
+namespace JsDebug
+{
+    // Keeps the most recent console messages whether or not a frontend is attached, so one that attaches later can
+    // still be shown what was logged. Each message is kept as the notification that would have been sent for it,
+    // without object ids since those mean nothing to a later frontend. Both the number of messages and the length of
+    // each one are capped.
+    class ConsoleMessages
+    {
+    public:
+        ConsoleMessages(size_t capacity, size_t maxMessageLength, int executionContextId);
+        ConsoleMessages(const ConsoleMessages&) = delete;
+        ConsoleMessages& operator=(const ConsoleMessages&) = delete;
+
+        // Keeps a message that no frontend sees as it's logged. Its arguments are wrapped as short summaries, and only
+        // as many as fit. The first argument is the console object itself.
+        void Add(const protocol::String& type, const JsValueRef* arguments, size_t argumentCount);
+
+        // Keeps a message whose arguments were already wrapped for the attached frontend, and builds the notification
+        // to send it with from the same serialized arguments.
+        void Add(
+            const protocol::String& type,
+            protocol::Array<protocol::Runtime::RemoteObject>& args,
+            protocol::String* notification);
+
+        // Sends the kept messages to the frontend, oldest first.
+        void Replay(protocol::FrontendChannel* frontendChannel) const;
+        void Clear();
+
+        size_t GetMessageCount() const;
+
+    private:
+        double Keep(const protocol::String& type, const std::vector<protocol::String>& args);
+        protocol::String BuildNotification(
+            const protocol::String& type,
+            const std::vector<protocol::String>& args,
+            double timestamp) const;
+
+        size_t m_maxMessageLength;
+        int m_executionContextId;
+        double m_timestamp;
+
+        // Used as a ring. The slots are allocated up front and the oldest message is overwritten once they're full.
+        std::vector<protocol::String> m_messages;
+        size_t m_next;
+        size_t m_count;
+    };
+}
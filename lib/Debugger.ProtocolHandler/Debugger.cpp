@@ -8,6 +8,8 @@
 #include "PropertyHelpers.h"
 #include "ProtocolHandler.h"
 
+#include <algorithm>
+
 namespace JsDebug
 {
     namespace
@@ -23,6 +25,14 @@ namespace JsDebug
         , m_isPaused(false)
         , m_isRunningNestedMessageLoop(false)
         , m_shouldPauseOnNextStatement(false)
+        , m_isTimeTravelReplay(false)
+        , m_oneShotBreakpointId(-1)
+        , m_isSteppingUntil(false)
+        , m_stepCondition()
+        , m_stepCount(0)
+        , m_stepStartDepth(0)
+        , m_asyncStackRecorder(this)
+        , m_objectGroups()
         , m_sourceEventCallback(nullptr)
         , m_sourceEventCallbackState(nullptr)
         , m_breakEventCallback(nullptr)
@@ -70,6 +80,7 @@ namespace JsDebug
         }
 
         m_isEnabled = false;
+        m_isSteppingUntil = false;
         ClearBreakpoints();
     }
 
@@ -157,11 +168,49 @@ namespace JsDebug
     DebuggerObject Debugger::GetObjectFromHandle(int handle)
     {
         JsValueRef obj = JS_INVALID_REFERENCE;
-        IfJsErrorThrow(JsDiagGetObjectFromHandle(handle, &obj));
+        if (!m_objectGroups.TryGet(handle, &obj))
+        {
+            IfJsErrorThrow(JsDiagGetObjectFromHandle(handle, &obj));
+        }
 
         return DebuggerObject(obj);
     }
 
+    void Debugger::AddToObjectGroup(const String16& group, JsValueRef object)
+    {
+        m_objectGroups.Add(group, object);
+    }
+
+    void Debugger::AddToObjectGroup(const String16& group, int handle)
+    {
+        JsValueRef obj = JS_INVALID_REFERENCE;
+        if (!m_objectGroups.TryGet(handle, &obj))
+        {
+            IfJsErrorThrow(JsDiagGetObjectFromHandle(handle, &obj));
+            m_objectGroups.Add(group, obj);
+        }
+    }
+
+    bool Debugger::TryGetObjectGroup(int handle, String16* group)
+    {
+        return m_objectGroups.TryGetGroup(handle, group);
+    }
+
+    bool Debugger::IsObjectReleased(int handle)
+    {
+        return m_objectGroups.IsReleased(handle);
+    }
+
+    bool Debugger::ReleaseObject(int handle)
+    {
+        return m_objectGroups.Release(handle);
+    }
+
+    void Debugger::ReleaseObjectGroup(const String16& group)
+    {
+        m_objectGroups.ReleaseGroup(group);
+    }
+
     void Debugger::SetBreakpoint(DebuggerBreakpoint& breakpoint)
     {
         int scriptId = breakpoint.GetScriptId().toInteger();
@@ -180,6 +229,33 @@ namespace JsDebug
         IfJsErrorThrow(JsDiagRemoveBreakpoint(breakpoint.GetActualId()));
     }
 
+    void Debugger::ContinueToLocation(DebuggerBreakpoint& breakpoint)
+    {
+        // Only a single temporary breakpoint can be active at a time.
+        RemoveOneShotBreakpoint();
+
+        // The engine hands back the existing breakpoint if one was already set at the resolved location. That
+        // breakpoint belongs to the frontend and must survive the next break, so it isn't tracked as one-shot. If the
+        // existing breakpoints can't be listed, nothing is known to be safe to remove, so the command fails instead.
+        std::vector<int> existingIds;
+        IfJsErrorThrow(GetBreakpointIds(&existingIds));
+
+        SetBreakpoint(breakpoint);
+
+        if (!breakpoint.IsResolved())
+        {
+            return;
+        }
+
+        int breakpointId = breakpoint.GetActualId();
+        if (std::find(existingIds.begin(), existingIds.end(), breakpointId) == existingIds.end())
+        {
+            m_oneShotBreakpointId = breakpointId;
+        }
+
+        Continue();
+    }
+
     JsDiagBreakOnExceptionAttributes Debugger::GetBreakOnException()
     {
         JsDiagBreakOnExceptionAttributes attributes = JsDiagBreakOnExceptionAttributeNone;
@@ -205,22 +281,85 @@ namespace JsDebug
 
     void Debugger::StepIn()
     {
+        m_isSteppingUntil = false;
         IfJsErrorThrow(JsDiagSetStepType(JsDiagStepTypeStepIn));
         Continue();
     }
 
     void Debugger::StepOut()
     {
+        m_isSteppingUntil = false;
         IfJsErrorThrow(JsDiagSetStepType(JsDiagStepTypeStepOut));
         Continue();
     }
 
     void Debugger::StepOver()
     {
+        m_isSteppingUntil = false;
         IfJsErrorThrow(JsDiagSetStepType(JsDiagStepTypeStepOver));
         Continue();
     }
 
+    void Debugger::StepUntil(const StepCondition& condition)
+    {
+        IfJsErrorThrow(JsDiagSetStepType(condition.stepType));
+
+        m_isSteppingUntil = true;
+        m_stepCondition = condition;
+        m_stepCount = 0;
+
+        // Every completed step out leaves the frame, so only the other step types need to know the depth they
+        // started at.
+        bool needsDepth = condition.stopOnFrameDepthChange && condition.stepType != JsDiagStepTypeStepOut;
+        m_stepStartDepth = needsDepth ? GetStackDepth() : 0;
+
+        Continue();
+    }
+
+    void Debugger::StepBack()
+    {
+        m_isSteppingUntil = false;
+        IfJsErrorThrow(JsDiagSetStepType(JsDiagStepTypeStepBack));
+        Continue();
+    }
+
+    void Debugger::ReverseContinue()
+    {
+        m_isSteppingUntil = false;
+        IfJsErrorThrow(JsDiagSetStepType(JsDiagStepTypeReverseContinue));
+        Continue();
+    }
+
+    bool Debugger::IsTimeTravelReplay() const
+    {
+        return m_isTimeTravelReplay;
+    }
+
+    void Debugger::SetTimeTravelReplay(bool isReplay)
+    {
+        m_isTimeTravelReplay = isReplay;
+    }
+
+    void Debugger::SetAsyncCallStackDepth(int maxDepth)
+    {
+        m_asyncStackRecorder.SetMaxDepth(maxDepth);
+    }
+
+    void Debugger::AsyncTaskScheduled(void* task, const char* description)
+    {
+        m_asyncStackRecorder.TaskScheduled(task, description);
+    }
+
+    void Debugger::AsyncTaskStarted(void* task)
+    {
+        m_asyncStackRecorder.TaskStarted(task);
+    }
+
+    void Debugger::AsyncTaskFinished(void* task)
+    {
+        m_asyncStackRecorder.TaskFinished(task);
+    }
+
     void Debugger::DebugEventCallback(JsDiagDebugEvent debugEvent, JsValueRef eventData, void* callbackState)
     {
         auto protocolHandler = static_cast<Debugger*>(callbackState);
@@ -249,14 +388,14 @@ namespace JsDebug
         case JsDiagDebugEventStepComplete:
         case JsDiagDebugEventDebuggerStatement:
         case JsDiagDebugEventRuntimeException:
-            HandleBreak(eventData);
+            HandleBreak(debugEvent, eventData);
             break;
 
         case JsDiagDebugEventAsyncBreak:
             if (m_shouldPauseOnNextStatement)
             {
                 m_shouldPauseOnNextStatement = false;
-                HandleBreak(eventData);
+                HandleBreak(debugEvent, eventData);
             }
 
             break;
@@ -272,7 +411,7 @@ namespace JsDebug
         }
     }
 
-    void Debugger::HandleBreak(JsValueRef eventData)
+    void Debugger::HandleBreak(JsDiagDebugEvent debugEvent, JsValueRef eventData)
     {
         if (m_isRunningNestedMessageLoop)
         {
@@ -280,11 +419,26 @@ namespace JsDebug
             return;
         }
 
+        // Any break ends a pending ContinueToLocation, whether or not the target location was reached.
+        RemoveOneShotBreakpoint();
+
+        DebuggerBreak breakInfo(debugEvent, eventData, &m_asyncStackRecorder);
+
+        if (m_isSteppingUntil)
+        {
+            if (ShouldContinueStepping(breakInfo))
+            {
+                IfJsErrorThrow(JsDiagSetStepType(m_stepCondition.stepType));
+                return;
+            }
+
+            m_isSteppingUntil = false;
+        }
+
         if (m_breakEventCallback != nullptr)
         {
             m_isPaused = true;
 
-            DebuggerBreak breakInfo(eventData);
             SkipPauseRequest request = m_breakEventCallback(breakInfo, m_breakEventCallbackState);
 
             if (request == SkipPauseRequest::RequestNoSkip)
@@ -296,6 +450,9 @@ namespace JsDebug
 
             m_isPaused = false;
 
+            // Handles from this break are meaningless once it ends.
+            m_objectGroups.Clear();
+
             if (request == SkipPauseRequest::RequestStepFrame ||
                 request == SkipPauseRequest::RequestStepInto)
             {
@@ -308,22 +465,94 @@ namespace JsDebug
         }
     }
 
+    int Debugger::GetStackDepth()
+    {
+        JsValueRef stackTrace = JS_INVALID_REFERENCE;
+        IfJsErrorThrow(JsDiagGetStackTrace(&stackTrace));
+
+        return PropertyHelpers::GetPropertyInt(stackTrace, PropertyHelpers::Names::Length);
+    }
+
+    bool Debugger::ShouldContinueStepping(const DebuggerBreak& breakInfo)
+    {
+        // Breakpoints, exceptions and debugger statements end the stepping and pause as usual.
+        if (!breakInfo.IsStepComplete())
+        {
+            return false;
+        }
+
+        if (++m_stepCount >= m_stepCondition.maxSteps)
+        {
+            return false;
+        }
+
+        if (m_stepCondition.scriptId != -1 &&
+            m_stepCondition.scriptId == breakInfo.GetScriptId() &&
+            m_stepCondition.lineNumber == breakInfo.GetLineNumber())
+        {
+            return false;
+        }
+
+        if (m_stepCondition.stopOnFrameDepthChange)
+        {
+            // The engine only reports the depth through the full stack trace, so it is fetched last and not at all
+            // for step out.
+            if (m_stepCondition.stepType == JsDiagStepTypeStepOut || GetStackDepth() != m_stepStartDepth)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     void Debugger::ClearBreakpoints()
     {
         // Ensure that there's an active context before trying to remove breakpoints.
         DebuggerContext::Scope debuggerScope(m_debugContext);
 
-        JsValueRef breakpoints = JS_INVALID_REFERENCE;
-        if (JsDiagGetBreakpoints(&breakpoints) == JsNoError)
+        std::vector<int> breakpointIds;
+        if (GetBreakpointIds(&breakpointIds) == JsNoError)
         {
-            int length = PropertyHelpers::GetPropertyInt(breakpoints, PropertyHelpers::Names::Length);
-
-            for (int index = 0; index < length; index++)
+            for (int breakpointId : breakpointIds)
             {
-                JsValueRef breakpoint = PropertyHelpers::GetIndexedProperty(breakpoints, index);
-                int breakpointId = PropertyHelpers::GetPropertyInt(breakpoint, PropertyHelpers::Names::BreakpointId);
                 IfJsErrorThrow(JsDiagRemoveBreakpoint(breakpointId));
             }
         }
+
+        m_oneShotBreakpointId = -1;
+    }
+
+    JsErrorCode Debugger::GetBreakpointIds(std::vector<int>* breakpointIds)
+    {
+        JsValueRef breakpoints = JS_INVALID_REFERENCE;
+        JsErrorCode err = JsDiagGetBreakpoints(&breakpoints);
+        if (err != JsNoError)
+        {
+            return err;
+        }
+
+        int length = PropertyHelpers::GetPropertyInt(breakpoints, PropertyHelpers::Names::Length);
+        breakpointIds->reserve(length);
+
+        for (int index = 0; index < length; index++)
+        {
+            JsValueRef breakpoint = PropertyHelpers::GetIndexedProperty(breakpoints, index);
+            breakpointIds->push_back(PropertyHelpers::GetPropertyInt(breakpoint, PropertyHelpers::Names::BreakpointId));
+        }
+
+        return JsNoError;
+    }
+
+    void Debugger::RemoveOneShotBreakpoint()
+    {
+        if (m_oneShotBreakpointId != -1)
+        {
+            int breakpointId = m_oneShotBreakpointId;
+            m_oneShotBreakpointId = -1;
+
+            // The breakpoint may already be gone if the frontend removed all breakpoints in the meantime.
+            JsDiagRemoveBreakpoint(breakpointId);
+        }
     }
 }
@@ -3,12 +3,14 @@
 
 #pragma once
 
+#include "AsyncStackRecorder.h"
 #include "DebuggerBreak.h"
 #include "DebuggerBreakpoint.h"
 #include "DebuggerCallFrame.h"
 #include "DebuggerContext.h"
 #include "DebuggerObject.h"
 #include "DebuggerScript.h"
+#include "ObjectGroups.h"
 
 #include <ChakraCore.h>
 #include <vector>
@@ -25,6 +27,18 @@ namespace JsDebug
         RequestStepFrame
     };
 
+    struct StepCondition
+    {
+        JsDiagStepType stepType;
+
+        // Stop on reaching this line of the script. A script ID of -1 disables the check.
+        int scriptId;
+        int lineNumber;
+
+        bool stopOnFrameDepthChange;
+        int maxSteps;
+    };
+
     typedef void(*DebuggerSourceEventHandler)(const DebuggerScript& scriptInfo, bool success, void* callbackState);
     typedef SkipPauseRequest(*DebuggerBreakEventHandler)(const DebuggerBreak& breakInfo, void* callbackState);
 
@@ -52,8 +66,16 @@ namespace JsDebug
         std::vector<DebuggerCallFrame> GetCallFrames(int limit = 0);
         DebuggerObject GetObjectFromHandle(int handle);
 
+        void AddToObjectGroup(const String16& group, JsValueRef object);
+        void AddToObjectGroup(const String16& group, int handle);
+        bool TryGetObjectGroup(int handle, String16* group);
+        bool IsObjectReleased(int handle);
+        bool ReleaseObject(int handle);
+        void ReleaseObjectGroup(const String16& group);
+
         void SetBreakpoint(DebuggerBreakpoint& breakpoint);
         void RemoveBreakpoint(DebuggerBreakpoint& breakpoint);
+        void ContinueToLocation(DebuggerBreakpoint& breakpoint);
 
         JsDiagBreakOnExceptionAttributes GetBreakOnException();
         void SetBreakOnException(JsDiagBreakOnExceptionAttributes attributes);
@@ -63,6 +85,17 @@ namespace JsDebug
         void StepIn();
         void StepOut();
         void StepOver();
+        void StepUntil(const StepCondition& condition);
+        void StepBack();
+        void ReverseContinue();
+
+        bool IsTimeTravelReplay() const;
+        void SetTimeTravelReplay(bool isReplay);
+
+        void SetAsyncCallStackDepth(int maxDepth);
+        void AsyncTaskScheduled(void* task, const char* description);
+        void AsyncTaskStarted(void* task);
+        void AsyncTaskFinished(void* task);
 
     private:
         static void CHAKRA_CALLBACK DebugEventCallback(
@@ -72,9 +105,14 @@ namespace JsDebug
 
         void HandleDebugEvent(JsDiagDebugEvent debugEvent, JsValueRef eventData);
         void HandleSourceEvent(JsValueRef eventData, bool success);
-        void HandleBreak(JsValueRef eventData);
+        void HandleBreak(JsDiagDebugEvent debugEvent, JsValueRef eventData);
 
         void ClearBreakpoints();
+        JsErrorCode GetBreakpointIds(std::vector<int>* breakpointIds);
+        void RemoveOneShotBreakpoint();
+
+        int GetStackDepth();
+        bool ShouldContinueStepping(const DebuggerBreak& breakInfo);
 
         ProtocolHandler* m_handler;
         JsRuntimeHandle m_runtime;
@@ -85,6 +123,21 @@ namespace JsDebug
         bool m_isRunningNestedMessageLoop;
         bool m_shouldPauseOnNextStatement;
 
+        // Set by the host, since the engine doesn't report whether the runtime is replaying a time-travel log.
+        bool m_isTimeTravelReplay;
+
+        // Engine ID of the temporary breakpoint used by ContinueToLocation, or -1 if there isn't one.
+        int m_oneShotBreakpointId;
+
+        // State for StepUntil, which repeats steps here without notifying the break handler until the condition holds.
+        bool m_isSteppingUntil;
+        StepCondition m_stepCondition;
+        int m_stepCount;
+        int m_stepStartDepth;
+
+        AsyncStackRecorder m_asyncStackRecorder;
+        ObjectGroups m_objectGroups;
+
         DebuggerSourceEventHandler m_sourceEventCallback;
         void* m_sourceEventCallbackState;
 
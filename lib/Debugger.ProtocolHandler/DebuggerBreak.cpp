@@ -18,11 +18,33 @@ namespace JsDebug
     using protocol::Runtime::StackTrace;
     using protocol::String;
 
-    DebuggerBreak::DebuggerBreak(JsValueRef breakInfo)
-        : m_breakInfo(breakInfo)
+    DebuggerBreak::DebuggerBreak(JsDiagDebugEvent debugEvent, JsValueRef breakInfo, AsyncStackRecorder* asyncStackRecorder)
+        : m_debugEvent(debugEvent)
+        , m_breakInfo(breakInfo)
+        , m_asyncStackRecorder(asyncStackRecorder)
     {
     }
 
+    bool DebuggerBreak::IsStepComplete() const
+    {
+        return m_debugEvent == JsDiagDebugEventStepComplete;
+    }
+
+    int DebuggerBreak::GetScriptId() const
+    {
+        return PropertyHelpers::GetPropertyInt(m_breakInfo.Get(), PropertyHelpers::Names::ScriptId);
+    }
+
+    int DebuggerBreak::GetLineNumber() const
+    {
+        return PropertyHelpers::GetPropertyInt(m_breakInfo.Get(), PropertyHelpers::Names::Line);
+    }
+
+    int DebuggerBreak::GetColumnNumber() const
+    {
+        return PropertyHelpers::GetPropertyInt(m_breakInfo.Get(), PropertyHelpers::Names::Column);
+    }
+
     String DebuggerBreak::GetReason() const
     {
         JsValueRef exception = JS_INVALID_REFERENCE;
@@ -77,6 +99,16 @@ namespace JsDebug
 
     Maybe<StackTrace> DebuggerBreak::GetAsyncStackTrace() const
     {
+        // Only built when the pause is reported, so skipped steps don't pay for it.
+        if (m_asyncStackRecorder != nullptr)
+        {
+            std::unique_ptr<StackTrace> stackTrace = m_asyncStackRecorder->GetAsyncStackTrace();
+            if (stackTrace != nullptr)
+            {
+                return std::move(stackTrace);
+            }
+        }
+
         return Maybe<StackTrace>();
     }
 
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "AsyncStackRecorder.h"
 #include "JsPersistent.h"
 #include <ChakraCore.h>
 
@@ -16,7 +17,12 @@ namespace JsDebug
     class DebuggerBreak
     {
     public:
-        explicit DebuggerBreak(JsValueRef breakInfo);
+        DebuggerBreak(JsDiagDebugEvent debugEvent, JsValueRef breakInfo, AsyncStackRecorder* asyncStackRecorder);
+
+        bool IsStepComplete() const;
+        int GetScriptId() const;
+        int GetLineNumber() const;
+        int GetColumnNumber() const;
 
         protocol::String GetReason() const;
         protocol::Maybe<protocol::DictionaryValue> GetData() const;
@@ -29,6 +35,8 @@ namespace JsDebug
     private:
         std::unique_ptr<protocol::Runtime::RemoteObject> GetException() const;
 
+        JsDiagDebugEvent m_debugEvent;
         JsPersistent m_breakInfo;
+        AsyncStackRecorder* m_asyncStackRecorder;
     };
 }
@@ -77,7 +77,9 @@ namespace JsDebug
     std::unique_ptr<RemoteObject> DebuggerCallFrame::Evaluate(
         const String& expression,
         bool returnByValue,
-        std::unique_ptr<ExceptionDetails>* exceptionDetails)
+        bool generatePreview,
+        std::unique_ptr<ExceptionDetails>* exceptionDetails,
+        JsValueRef* resultObject)
     {
         JsValueRef expressionStr = JS_INVALID_REFERENCE;
         IfJsErrorThrow(JsCreateStringUtf16(expression.characters16(), expression.length(), &expressionStr));
@@ -90,6 +92,11 @@ namespace JsDebug
             returnByValue,
             &evalResult);
 
+        if (resultObject != nullptr)
+        {
+            *resultObject = evalResult;
+        }
+
         if (err == JsErrorScriptException)
         {
             if (exceptionDetails != nullptr)
@@ -101,7 +108,18 @@ namespace JsDebug
         }
 
         IfJsErrorThrow(err);
-        return ProtocolHelpers::WrapObject(evalResult);
+        auto result = ProtocolHelpers::WrapObject(evalResult, returnByValue);
+
+        if (generatePreview)
+        {
+            auto preview = DebuggerObject(evalResult).GetPreview(*result);
+            if (preview != nullptr)
+            {
+                result->setPreview(std::move(preview));
+            }
+        }
+
+        return result;
     }
 
     std::unique_ptr<CallFrame> DebuggerCallFrame::ToProtocolValue() const
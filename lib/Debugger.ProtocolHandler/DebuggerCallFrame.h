@@ -28,7 +28,9 @@ namespace JsDebug
         std::unique_ptr<protocol::Runtime::RemoteObject> Evaluate(
             const protocol::String& expression,
             bool returnByValue,
-            std::unique_ptr<protocol::Runtime::ExceptionDetails>* exceptionDetails);
+            bool generatePreview,
+            std::unique_ptr<protocol::Runtime::ExceptionDetails>* exceptionDetails,
+            JsValueRef* resultObject = nullptr);
         std::unique_ptr<protocol::Debugger::CallFrame> ToProtocolValue() const;
 
     private:
@@ -10,14 +10,18 @@
 namespace JsDebug
 {
     DebuggerContext::Scope::Scope(const DebuggerContext& context)
+        : Scope(context.m_context.Get())
+    {
+    }
+
+    DebuggerContext::Scope::Scope(JsContextRef context)
     {
         JsContextRef currentContext = JS_INVALID_REFERENCE;
         IfJsErrorThrow(JsGetCurrentContext(&currentContext));
         m_previousContext = currentContext;
 
-        JsContextRef newContext = context.m_context.Get();
-        IfJsErrorThrow(JsSetCurrentContext(newContext));
-        m_currentContext = newContext;
+        IfJsErrorThrow(JsSetCurrentContext(context));
+        m_currentContext = context;
     }
 
     DebuggerContext::Scope::~Scope()
@@ -44,10 +48,20 @@ namespace JsDebug
         }
     }
 
+    JsContextRef DebuggerContext::Scope::GetPreviousContext() const
+    {
+        return m_previousContext.Get();
+    }
+
     DebuggerContext::DebuggerContext(JsRuntimeHandle runtime)
     {
         JsContextRef context = JS_INVALID_REFERENCE;
         IfJsErrorThrow(JsCreateContext(runtime, &context));
         m_context = context;
     }
+
+    JsContextRef DebuggerContext::GetContext() const
+    {
+        return m_context.Get();
+    }
 }
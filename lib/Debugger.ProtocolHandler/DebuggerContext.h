@@ -15,8 +15,12 @@ namespace JsDebug
         {
         public:
             explicit Scope(const DebuggerContext& context);
+            explicit Scope(JsContextRef context);
             ~Scope();
 
+            // The context that was current when the scope was entered, which is restored when it's left.
+            JsContextRef GetPreviousContext() const;
+
         private:
             JsPersistent m_currentContext;
             JsPersistent m_previousContext;
@@ -24,6 +28,8 @@ namespace JsDebug
 
         explicit DebuggerContext(JsRuntimeHandle runtime);
 
+        JsContextRef GetContext() const;
+
     private:
 
         JsPersistent m_context;
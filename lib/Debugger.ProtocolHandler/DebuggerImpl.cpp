@@ -17,6 +17,7 @@ namespace JsDebug
 {
     using protocol::Array;
     using protocol::Debugger::CallFrame;
+    using protocol::Debugger::EvaluationResult;
     using protocol::Debugger::Location;
     using protocol::FrontendChannel;
     using protocol::Maybe;
@@ -28,13 +29,20 @@ namespace JsDebug
 
     namespace
     {
+        const int c_DefaultMaxSteps = 1000;
+
         const char c_ErrorBreakpointCouldNotResolve[] = "Breakpoint could not be resolved";
         const char c_ErrorBreakpointExists[] = "Breakpoint at specified location already exists";
         const char c_ErrorBreakpointNotFound[] = "Breakpoint could not be found";
         const char c_ErrorCallFrameInvalidId[] = "Invalid call frame ID specified";
         const char c_ErrorInvalidColumnNumber[] = "Invalid column number specified";
+        const char c_ErrorInvalidMaxSteps[] = "Maximum number of steps must be positive";
+        const char c_ErrorInvalidPosition[] = "Position line and column must be non-negative";
         const char c_ErrorNotEnabled[] = "Debugger is not enabled";
         const char c_ErrorNotImplemented[] = "Debugger method not implemented";
+        const char c_ErrorNotPaused[] = "Can only perform operation while paused";
+        const char c_ErrorPositionsNotSorted[] = "Input positions array is not sorted";
+        const char c_ErrorScriptNotFound[] = "No script with given id found";
         const char c_ErrorScriptMustBeLoaded[] = "Script must be loaded before resolving";
         const char c_ErrorUrlRequired[] = "Either url or urlRegex must be specified";
     }
@@ -81,12 +89,14 @@ namespace JsDebug
         }
 
         m_isEnabled = false;
+        m_debugger->SetAsyncCallStackDepth(0);
         m_debugger->Disable();
         m_debugger->SetSourceEventHandler(nullptr, nullptr);
 
         m_breakpointMap.clear();
         m_scriptMap.clear();
         m_shouldSkipAllPauses = false;
+        m_blackboxPattern.reset();
 
         return Response::OK();
     }
@@ -225,7 +235,33 @@ namespace JsDebug
 
     Response DebuggerImpl::continueToLocation(std::unique_ptr<Location> in_location)
     {
-        return Response::Error(c_ErrorNotImplemented);
+        if (!IsEnabled())
+        {
+            return Response::Error(c_ErrorNotEnabled);
+        }
+
+        if (!m_debugger->IsPaused())
+        {
+            return Response::Error(c_ErrorNotPaused);
+        }
+
+        DebuggerBreakpoint breakpoint = DebuggerBreakpoint::FromLocation(m_debugger, in_location.get(), "");
+
+        if (!breakpoint.IsScriptLoaded())
+        {
+            return Response::Error(c_ErrorScriptMustBeLoaded);
+        }
+
+        // The temporary breakpoint is set and execution resumed as part of this single command, so the target
+        // location can't be missed by a round trip through the frontend.
+        m_debugger->ContinueToLocation(breakpoint);
+
+        if (!breakpoint.IsResolved())
+        {
+            return Response::Error(c_ErrorBreakpointCouldNotResolve);
+        }
+
+        return Response::OK();
     }
 
     Response DebuggerImpl::stepOver()
@@ -246,6 +282,63 @@ namespace JsDebug
         return Response::OK();
     }
 
+    Response DebuggerImpl::stepUntil(
+        const String & in_stepType,
+        Maybe<Location> in_location,
+        Maybe<bool> in_stopOnFrameDepthChange,
+        Maybe<int> in_maxSteps)
+    {
+        if (!IsEnabled())
+        {
+            return Response::Error(c_ErrorNotEnabled);
+        }
+
+        if (!m_debugger->IsPaused())
+        {
+            return Response::Error(c_ErrorNotPaused);
+        }
+
+        StepCondition condition = {};
+
+        if (in_stepType == protocol::Debugger::StepUntil::StepTypeEnum::StepInto)
+        {
+            condition.stepType = JsDiagStepTypeStepIn;
+        }
+        else if (in_stepType == protocol::Debugger::StepUntil::StepTypeEnum::StepOver)
+        {
+            condition.stepType = JsDiagStepTypeStepOver;
+        }
+        else if (in_stepType == protocol::Debugger::StepUntil::StepTypeEnum::StepOut)
+        {
+            condition.stepType = JsDiagStepTypeStepOut;
+        }
+        else
+        {
+            return Response::Error("Unrecognized step type value: " + in_stepType);
+        }
+
+        condition.scriptId = -1;
+        condition.lineNumber = -1;
+
+        if (in_location.isJust())
+        {
+            Location* location = in_location.fromJust();
+            condition.scriptId = location->getScriptId().toInteger();
+            condition.lineNumber = location->getLineNumber();
+        }
+
+        condition.stopOnFrameDepthChange = in_stopOnFrameDepthChange.fromMaybe(false);
+        condition.maxSteps = in_maxSteps.fromMaybe(c_DefaultMaxSteps);
+
+        if (condition.maxSteps <= 0)
+        {
+            return Response::Error(c_ErrorInvalidMaxSteps);
+        }
+
+        m_debugger->StepUntil(condition);
+        return Response::OK();
+    }
+
     Response DebuggerImpl::pause()
     {
         m_debugger->PauseOnNextStatement();
@@ -342,7 +435,7 @@ namespace JsDebug
         Maybe<bool> /*in_includeCommandLineAPI*/,
         Maybe<bool> /*in_silent*/,
         Maybe<bool> in_returnByValue,
-        Maybe<bool> /*in_generatePreview*/,
+        Maybe<bool> in_generatePreview,
         std::unique_ptr<protocol::Runtime::RemoteObject>* out_result,
         Maybe<protocol::Runtime::ExceptionDetails>* out_exceptionDetails)
     {
@@ -354,7 +447,18 @@ namespace JsDebug
             auto callFrame = m_debugger->GetCallFrame(ordinal);
 
             std::unique_ptr<ExceptionDetails> exceptionDetails;
-            *out_result = callFrame.Evaluate(in_expression, in_returnByValue.fromMaybe(false), &exceptionDetails);
+            JsValueRef resultObject = JS_INVALID_REFERENCE;
+            *out_result = callFrame.Evaluate(
+                in_expression,
+                in_returnByValue.fromMaybe(false),
+                in_generatePreview.fromMaybe(false),
+                &exceptionDetails,
+                &resultObject);
+
+            if (in_objectGroup.isJust())
+            {
+                m_debugger->AddToObjectGroup(in_objectGroup.fromJust(), resultObject);
+            }
 
             if (exceptionDetails != nullptr)
             {
@@ -367,6 +471,59 @@ namespace JsDebug
         return Response::Error(c_ErrorCallFrameInvalidId);
     }
 
+    Response DebuggerImpl::evaluateExpressionsOnCallFrame(
+        const String & in_callFrameId,
+        std::unique_ptr<Array<String>> in_expressions,
+        Maybe<String> in_objectGroup,
+        Maybe<bool> in_returnByValue,
+        Maybe<bool> in_generatePreview,
+        std::unique_ptr<Array<EvaluationResult>>* out_results)
+    {
+        auto parsedId = ProtocolHelpers::ParseObjectId(in_callFrameId);
+
+        int ordinal = 0;
+        if (!parsedId->getInteger(PropertyHelpers::Names::Ordinal, &ordinal))
+        {
+            return Response::Error(c_ErrorCallFrameInvalidId);
+        }
+
+        // Getting the frame walks the stack, so it's done once and every expression is evaluated against it. The
+        // engine doesn't expose compiled debugger evaluations, so each expression is still parsed when it's run.
+        auto callFrame = m_debugger->GetCallFrame(ordinal);
+        bool returnByValue = in_returnByValue.fromMaybe(false);
+        bool generatePreview = in_generatePreview.fromMaybe(false);
+
+        *out_results = Array<EvaluationResult>::create();
+
+        for (size_t index = 0; index < in_expressions->length(); ++index)
+        {
+            std::unique_ptr<ExceptionDetails> exceptionDetails;
+            JsValueRef resultObject = JS_INVALID_REFERENCE;
+            auto result = EvaluationResult::create()
+                .setResult(callFrame.Evaluate(
+                    in_expressions->get(index),
+                    returnByValue,
+                    generatePreview,
+                    &exceptionDetails,
+                    &resultObject))
+                .build();
+
+            if (in_objectGroup.isJust())
+            {
+                m_debugger->AddToObjectGroup(in_objectGroup.fromJust(), resultObject);
+            }
+
+            if (exceptionDetails != nullptr)
+            {
+                result->setExceptionDetails(std::move(exceptionDetails));
+            }
+
+            (*out_results)->addItem(std::move(result));
+        }
+
+        return Response::OK();
+    }
+
     Response DebuggerImpl::setVariableValue(
         int /*in_scopeNumber*/,
         const String & /*in_variableName*/,
@@ -376,21 +533,103 @@ namespace JsDebug
         return Response::Error(c_ErrorNotImplemented);
     }
 
-    Response DebuggerImpl::setAsyncCallStackDepth(int /*in_maxDepth*/)
+    Response DebuggerImpl::setAsyncCallStackDepth(int in_maxDepth)
     {
-        return Response::Error(c_ErrorNotImplemented);
+        if (!IsEnabled())
+        {
+            return Response::Error(c_ErrorNotEnabled);
+        }
+
+        m_debugger->SetAsyncCallStackDepth(in_maxDepth);
+        return Response::OK();
     }
 
     Response DebuggerImpl::setBlackboxPatterns(std::unique_ptr<Array<String>> in_patterns)
     {
-        return Response::Error(c_ErrorNotImplemented);
+        if (!IsEnabled())
+        {
+            return Response::Error(c_ErrorNotEnabled);
+        }
+
+        // Compile the patterns once as a single alternation so matching a script is one regular expression test
+        // regardless of how many patterns the frontend sends.
+        String16Builder combinedPattern;
+
+        for (size_t i = 0; i < in_patterns->length(); ++i)
+        {
+            if (i > 0)
+            {
+                combinedPattern.append('|');
+            }
+
+            combinedPattern.append("(?:", 3);
+            combinedPattern.append(in_patterns->get(i));
+            combinedPattern.append(')');
+        }
+
+        // An invalid pattern leaves the previous ones in place.
+        std::unique_ptr<DebuggerRegExp> blackboxPattern;
+
+        if (in_patterns->length() > 0)
+        {
+            try
+            {
+                blackboxPattern = std::make_unique<DebuggerRegExp>(m_debugger, combinedPattern.toString(), "");
+            }
+            catch (const JsErrorException& e)
+            {
+                return Response::Error(e.what());
+            }
+        }
+
+        m_blackboxPattern = std::move(blackboxPattern);
+
+        for (auto& script : m_scriptMap)
+        {
+            script.second.SetBlackboxed(IsUrlBlackboxed(script.second.SourceUrl()));
+        }
+
+        return Response::OK();
     }
 
     Response DebuggerImpl::setBlackboxedRanges(
-        const String & /*in_scriptId*/,
-        std::unique_ptr<Array<protocol::Debugger::ScriptPosition>> /*in_positions*/)
+        const String & in_scriptId,
+        std::unique_ptr<Array<protocol::Debugger::ScriptPosition>> in_positions)
     {
-        return Response::Error(c_ErrorNotImplemented);
+        if (!IsEnabled())
+        {
+            return Response::Error(c_ErrorNotEnabled);
+        }
+
+        auto result = m_scriptMap.find(in_scriptId);
+        if (result == m_scriptMap.end())
+        {
+            return Response::Error(c_ErrorScriptNotFound);
+        }
+
+        std::vector<std::pair<int, int>> positions;
+        positions.reserve(in_positions->length());
+
+        for (size_t i = 0; i < in_positions->length(); ++i)
+        {
+            protocol::Debugger::ScriptPosition* position = in_positions->get(i);
+            std::pair<int, int> value(position->getLineNumber(), position->getColumnNumber());
+
+            if (value.first < 0 || value.second < 0)
+            {
+                return Response::Error(c_ErrorInvalidPosition);
+            }
+
+            if (!positions.empty() && value <= positions.back())
+            {
+                return Response::Error(c_ErrorPositionsNotSorted);
+            }
+
+            positions.push_back(value);
+        }
+
+        result->second.SetBlackboxedRanges(positions);
+        return Response::OK();
     }
 
     void DebuggerImpl::SourceEventHandler(const DebuggerScript& script, bool success, void* callbackState)
@@ -454,7 +693,8 @@ namespace JsDebug
                 script.HasSourceUrl());
         }
 
-        m_scriptMap.emplace(scriptId, script);
+        auto result = m_scriptMap.emplace(scriptId, script);
+        result.first->second.SetBlackboxed(IsUrlBlackboxed(scriptUrl));
 
         for (auto& breakpoint : m_breakpointMap)
         {
@@ -532,6 +772,12 @@ namespace JsDebug
         {
             request = SkipPauseRequest::RequestContinue;
         }
+        else if (IsBreakBlackboxed(breakInfo))
+        {
+            // Keep stepping through blackboxed code without building call frames or notifying the frontend. Stepping
+            // out instead would run any user callbacks the library calls without stopping in them.
+            request = SkipPauseRequest::RequestStepFrame;
+        }
         else
         {
             request = EvaluateConditionOnBreakpoint(breakInfo.GetHitBreakpoint());
@@ -559,6 +805,33 @@ namespace JsDebug
         return request;
     }
 
+    bool DebuggerImpl::IsUrlBlackboxed(const String& url)
+    {
+        if (m_blackboxPattern == nullptr || url.empty())
+        {
+            return false;
+        }
+
+        return m_blackboxPattern->Test(url);
+    }
+
+    bool DebuggerImpl::IsBreakBlackboxed(const DebuggerBreak& breakInfo)
+    {
+        // Only steps are skipped, explicit breakpoints and exceptions in blackboxed code still pause.
+        if (!breakInfo.IsStepComplete())
+        {
+            return false;
+        }
+
+        auto result = m_scriptMap.find(String::fromInteger(breakInfo.GetScriptId()));
+        if (result == m_scriptMap.end())
+        {
+            return false;
+        }
+
+        return result->second.IsBlackboxedAt(breakInfo.GetLineNumber(), breakInfo.GetColumnNumber());
+    }
+
     bool DebuggerImpl::TryResolveBreakpoint(DebuggerBreakpoint& breakpoint)
     {
         if (!breakpoint.IsScriptLoaded())
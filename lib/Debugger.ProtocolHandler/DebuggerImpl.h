@@ -8,6 +8,7 @@
 
 #include "Debugger.h"
 #include "DebuggerBreakpoint.h"
+#include "DebuggerRegExp.h"
 #include "DebuggerScript.h"
 
 #include <ChakraCore.h>
@@ -47,6 +48,11 @@ namespace JsDebug
         protocol::Response stepOver() override;
         protocol::Response stepInto() override;
         protocol::Response stepOut() override;
+        protocol::Response stepUntil(
+            const protocol::String& in_stepType,
+            protocol::Maybe<protocol::Debugger::Location> in_location,
+            protocol::Maybe<bool> in_stopOnFrameDepthChange,
+            protocol::Maybe<int> in_maxSteps) override;
         protocol::Response pause() override;
         protocol::Response resume() override;
         protocol::Response searchInContent(
@@ -81,6 +87,13 @@ namespace JsDebug
             protocol::Maybe<bool> in_generatePreview,
             std::unique_ptr<protocol::Runtime::RemoteObject>* out_result,
             protocol::Maybe<protocol::Runtime::ExceptionDetails>* out_exceptionDetails) override;
+        protocol::Response evaluateExpressionsOnCallFrame(
+            const protocol::String& in_callFrameId,
+            std::unique_ptr<protocol::Array<protocol::String>> in_expressions,
+            protocol::Maybe<protocol::String> in_objectGroup,
+            protocol::Maybe<bool> in_returnByValue,
+            protocol::Maybe<bool> in_generatePreview,
+            std::unique_ptr<protocol::Array<protocol::Debugger::EvaluationResult>>* out_results) override;
         protocol::Response setVariableValue(
             int in_scopeNumber,
             const protocol::String& in_variableName,
@@ -101,6 +114,9 @@ namespace JsDebug
         void HandleSourceEvent(const DebuggerScript& script, bool success);
         SkipPauseRequest HandleBreakEvent(const DebuggerBreak& breakInfo);
 
+        bool IsUrlBlackboxed(const protocol::String& url);
+        bool IsBreakBlackboxed(const DebuggerBreak& breakInfo);
+
         bool TryResolveBreakpoint(DebuggerBreakpoint& breakpoint);
         SkipPauseRequest EvaluateConditionOnBreakpoint(int bpId);
 
@@ -113,5 +129,8 @@ namespace JsDebug
 
         protocol::HashMap<protocol::String, DebuggerScript> m_scriptMap;
         protocol::HashMap<protocol::String, DebuggerBreakpoint> m_breakpointMap;
+
+        // All blackbox patterns combined into a single expression, or null if there are none.
+        std::unique_ptr<DebuggerRegExp> m_blackboxPattern;
     };
 }
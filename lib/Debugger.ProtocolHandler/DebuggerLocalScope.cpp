@@ -5,7 +5,6 @@
 #include "DebuggerLocalScope.h"
 
 #include "PropertyHelpers.h"
-#include "ProtocolHelpers.h"
 
 namespace JsDebug
 {
@@ -18,14 +17,17 @@ namespace JsDebug
     {
     }
 
-    std::unique_ptr<Array<PropertyDescriptor>> DebuggerLocalScope::GetPropertyDescriptors() const
+    void DebuggerLocalScope::GetPropertyDescriptors(
+        bool generatePreview,
+        std::unique_ptr<Array<PropertyDescriptor>>* propertyDescriptors,
+        std::unique_ptr<Array<InternalPropertyDescriptor>>* internalPropertyDescriptors) const
     {
-        auto propertyDescriptors = Array<PropertyDescriptor>::create();
+        auto descriptors = Array<PropertyDescriptor>::create();
 
         JsValueRef arguments = JS_INVALID_REFERENCE;
         if (PropertyHelpers::TryGetProperty(m_object.Get(), PropertyHelpers::Names::Arguments, &arguments))
         {
-            propertyDescriptors->addItem(ProtocolHelpers::WrapProperty(arguments));
+            descriptors->addItem(WrapProperty(arguments, generatePreview));
         }
 
         JsValueRef functionCallsReturn = JS_INVALID_REFERENCE;
@@ -39,7 +41,7 @@ namespace JsDebug
             for (int index = 0; index < length; index++)
             {
                 JsValueRef prop = PropertyHelpers::GetIndexedProperty(functionCallsReturn, index);
-                propertyDescriptors->addItem(ProtocolHelpers::WrapProperty(prop));
+                descriptors->addItem(WrapProperty(prop, generatePreview));
             }
         }
 
@@ -51,15 +53,11 @@ namespace JsDebug
             for (int index = 0; index < length; index++)
             {
                 JsValueRef prop = PropertyHelpers::GetIndexedProperty(locals, index);
-                propertyDescriptors->addItem(ProtocolHelpers::WrapProperty(prop));
+                descriptors->addItem(WrapProperty(prop, generatePreview));
             }
         }
 
-        return propertyDescriptors;
-    }
-
-    std::unique_ptr<Array<InternalPropertyDescriptor>> DebuggerLocalScope::GetInternalPropertyDescriptors() const
-    {
-        return Array<InternalPropertyDescriptor>::create();
+        *propertyDescriptors = std::move(descriptors);
+        *internalPropertyDescriptors = Array<InternalPropertyDescriptor>::create();
     }
 }
@@ -12,9 +12,10 @@ namespace JsDebug
     public:
         explicit DebuggerLocalScope(JsValueRef stackProperties);
 
-        std::unique_ptr<protocol::Array<protocol::Runtime::PropertyDescriptor>>
-            GetPropertyDescriptors() const override;
-        std::unique_ptr<protocol::Array<protocol::Runtime::InternalPropertyDescriptor>>
-            GetInternalPropertyDescriptors() const override;
+        void GetPropertyDescriptors(
+            bool generatePreview,
+            std::unique_ptr<protocol::Array<protocol::Runtime::PropertyDescriptor>>* propertyDescriptors,
+            std::unique_ptr<protocol::Array<protocol::Runtime::InternalPropertyDescriptor>>* internalPropertyDescriptors)
+            const override;
     };
 }
@@ -7,15 +7,104 @@
 #include "PropertyHelpers.h"
 #include "ProtocolHelpers.h"
 
+#include <algorithm>
+
 namespace JsDebug
 {
     using protocol::Array;
     using protocol::Runtime::InternalPropertyDescriptor;
+    using protocol::Runtime::ObjectPreview;
     using protocol::Runtime::PropertyDescriptor;
+    using protocol::Runtime::PropertyPreview;
+    using protocol::Runtime::RemoteObject;
+    using protocol::String;
 
     namespace
     {
         const int c_MaxPropertyCount = 5000;
+
+        // Any range with more properties than this is returned as buckets of at most this many children each, which
+        // keeps the cost of expanding an object the same no matter how large it is.
+        const int c_MaxBucketChildren = 100;
+
+        // Previews are built for every object in a list of properties, so they only look at the first few
+        // properties of each one.
+        const int c_MaxPreviewProperties = 5;
+        const size_t c_MaxPreviewValueLength = 100;
+
+        String GetPreviewType(const String& type)
+        {
+            if (type == "function" || type == "undefined" || type == "string" || type == "number" ||
+                type == "boolean" || type == "symbol")
+            {
+                return type;
+            }
+
+            return "object";
+        }
+
+        bool IsIndexName(const String& name)
+        {
+            const UChar* characters = name.characters16();
+            size_t begin = 0;
+            size_t end = name.length();
+
+            // Array elements may be named either "0" or "[0]".
+            if (end >= 2 && characters[0] == '[' && characters[end - 1] == ']')
+            {
+                ++begin;
+                --end;
+            }
+
+            if (begin == end)
+            {
+                return false;
+            }
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (characters[i] < '0' || characters[i] > '9')
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        String GetPropertyName(JsValueRef properties, int index)
+        {
+            return PropertyHelpers::GetPropertyString(
+                PropertyHelpers::GetIndexedProperty(properties, index),
+                PropertyHelpers::Names::Name);
+        }
+
+        // Bucket labels show array elements as "0" even where the engine names them "[0]".
+        String GetLabelName(const String& name)
+        {
+            if (IsIndexName(name) && name.characters16()[0] == '[')
+            {
+                return name.substring(1, name.length() - 2);
+            }
+
+            return name;
+        }
+
+        int AddInternalProperties(Array<InternalPropertyDescriptor>* descriptors, JsValueRef diagProperties)
+        {
+            JsValueRef properties = PropertyHelpers::GetProperty(
+                diagProperties,
+                PropertyHelpers::Names::DebuggerOnlyProperties);
+            int length = PropertyHelpers::GetPropertyInt(properties, PropertyHelpers::Names::Length);
+
+            for (int index = 0; index < length; index++)
+            {
+                JsValueRef prop = PropertyHelpers::GetIndexedProperty(properties, index);
+                descriptors->addItem(ProtocolHelpers::WrapInternalProperty(prop));
+            }
+
+            return length;
+        }
     }
 
     DebuggerObject::DebuggerObject(JsValueRef obj)
@@ -29,49 +118,276 @@ namespace JsDebug
         }
     }
 
-    std::unique_ptr<Array<PropertyDescriptor>> DebuggerObject::GetPropertyDescriptors() const
+    void DebuggerObject::GetPropertyDescriptors(
+        bool generatePreview,
+        std::unique_ptr<Array<PropertyDescriptor>>* propertyDescriptors,
+        std::unique_ptr<Array<InternalPropertyDescriptor>>* internalPropertyDescriptors) const
     {
-        auto propertyDescriptors = Array<PropertyDescriptor>::create();
+        *propertyDescriptors = Array<PropertyDescriptor>::create();
+        *internalPropertyDescriptors = Array<InternalPropertyDescriptor>::create();
 
-        if (m_handle >= 0)
+        if (m_handle < 0)
         {
-            JsValueRef diagProperties = JS_INVALID_REFERENCE;
-            IfJsErrorThrow(JsDiagGetProperties(m_handle, 0, c_MaxPropertyCount, &diagProperties));
+            return;
+        }
 
-            JsValueRef properties = PropertyHelpers::GetProperty(diagProperties, PropertyHelpers::Names::Properties);
-            int length = PropertyHelpers::GetPropertyInt(properties, PropertyHelpers::Names::Length);
+        // Each call makes the engine walk the object, so both lists are filled from the same records.
+        JsValueRef diagProperties = GetDiagProperties(0, c_MaxBucketChildren);
+        JsValueRef properties = PropertyHelpers::GetProperty(diagProperties, PropertyHelpers::Names::Properties);
+        int length = PropertyHelpers::GetPropertyInt(properties, PropertyHelpers::Names::Length);
 
-            for (int index = 0; index < length; index++)
+        int total = 0;
+        if (!PropertyHelpers::TryGetProperty(diagProperties, PropertyHelpers::Names::TotalPropertiesOfObject, &total))
+        {
+            // Without a total the properties can't be paged, so fall back to getting as many as allowed.
+            diagProperties = GetDiagProperties(0, c_MaxPropertyCount);
+            properties = PropertyHelpers::GetProperty(diagProperties, PropertyHelpers::Names::Properties);
+            length = PropertyHelpers::GetPropertyInt(properties, PropertyHelpers::Names::Length);
+            total = length;
+        }
+
+        int internalCount = AddInternalProperties(internalPropertyDescriptors->get(), diagProperties);
+
+        if (total <= c_MaxBucketChildren)
+        {
+            AddProperties(propertyDescriptors->get(), properties, 0, length, generatePreview);
+            return;
+        }
+
+        // The engine doesn't say where named properties are listed relative to the array elements, so look for them at
+        // both ends: in front of the first element on the first page and after the last element on the last page.
+        // Whatever lies between is split into buckets. The last page starts after the first one so that nothing is
+        // listed twice.
+        int tailFrom = (std::max)(total - c_MaxBucketChildren, c_MaxBucketChildren);
+        JsValueRef tailDiagProperties = GetDiagProperties(tailFrom, c_MaxBucketChildren);
+        JsValueRef tailProperties = PropertyHelpers::GetProperty(tailDiagProperties, PropertyHelpers::Names::Properties);
+        int tailLength = PropertyHelpers::GetPropertyInt(tailProperties, PropertyHelpers::Names::Length);
+
+        internalCount += AddInternalProperties(internalPropertyDescriptors->get(), tailDiagProperties);
+
+        int headNamed = 0;
+        while (headNamed < length && !IsIndexName(GetPropertyName(properties, headNamed)))
+        {
+            ++headNamed;
+        }
+
+        int tailNamed = 0;
+        while (tailNamed < tailLength && !IsIndexName(GetPropertyName(tailProperties, tailLength - tailNamed - 1)))
+        {
+            ++tailNamed;
+        }
+
+        // A page without any elements gives no hint of where the named properties stop, such as on an object that
+        // isn't an array, so they're bucketed along with everything else.
+        if (headNamed == length)
+        {
+            headNamed = 0;
+        }
+
+        if (tailNamed == tailLength)
+        {
+            tailNamed = 0;
+        }
+
+        AddProperties(propertyDescriptors->get(), properties, 0, headNamed, generatePreview);
+
+        int bucketedCount = total - internalCount - headNamed - tailNamed;
+        if (bucketedCount > 0)
+        {
+            AddBuckets(propertyDescriptors->get(), headNamed, bucketedCount);
+        }
+
+        AddProperties(propertyDescriptors->get(), tailProperties, tailLength - tailNamed, tailLength, generatePreview);
+    }
+
+    std::unique_ptr<Array<PropertyDescriptor>> DebuggerObject::GetPropertyRangeDescriptors(
+        int from,
+        int count,
+        bool generatePreview) const
+    {
+        auto propertyDescriptors = Array<PropertyDescriptor>::create();
+
+        if (m_handle >= 0)
+        {
+            if (count > c_MaxBucketChildren)
             {
-                JsValueRef prop = PropertyHelpers::GetIndexedProperty(properties, index);
-                propertyDescriptors->addItem(ProtocolHelpers::WrapProperty(prop));
+                AddBuckets(propertyDescriptors.get(), from, count);
+            }
+            else
+            {
+                JsValueRef diagProperties = GetDiagProperties(from, count);
+                JsValueRef properties = PropertyHelpers::GetProperty(
+                    diagProperties,
+                    PropertyHelpers::Names::Properties);
+                int length = PropertyHelpers::GetPropertyInt(properties, PropertyHelpers::Names::Length);
+
+                AddProperties(propertyDescriptors.get(), properties, 0, (std::min)(length, count), generatePreview);
             }
         }
 
         return propertyDescriptors;
     }
 
-    std::unique_ptr<Array<InternalPropertyDescriptor>> DebuggerObject::GetInternalPropertyDescriptors() const
+    std::unique_ptr<ObjectPreview> DebuggerObject::GetPreview(RemoteObject& remoteObject) const
     {
-        auto propertyDescriptors = Array<InternalPropertyDescriptor>::create();
+        if (m_handle < 0 || remoteObject.getType() != "object")
+        {
+            return nullptr;
+        }
 
-        if (m_handle >= 0)
+        // Ask for one more than is shown so that overflow can be detected even without a total.
+        JsValueRef diagProperties = GetDiagProperties(0, c_MaxPreviewProperties + 1);
+        JsValueRef properties = PropertyHelpers::GetProperty(diagProperties, PropertyHelpers::Names::Properties);
+        int length = PropertyHelpers::GetPropertyInt(properties, PropertyHelpers::Names::Length);
+
+        int total = length;
+        PropertyHelpers::TryGetProperty(diagProperties, PropertyHelpers::Names::TotalPropertiesOfObject, &total);
+
+        auto propertyPreviews = Array<PropertyPreview>::create();
+        int previewCount = (std::min)(length, c_MaxPreviewProperties);
+
+        for (int index = 0; index < previewCount; index++)
         {
-            JsValueRef diagProperties = JS_INVALID_REFERENCE;
-            IfJsErrorThrow(JsDiagGetProperties(m_handle, 0, c_MaxPropertyCount, &diagProperties));
+            JsValueRef prop = PropertyHelpers::GetIndexedProperty(properties, index);
 
-            JsValueRef properties = PropertyHelpers::GetProperty(
-                diagProperties,
-                PropertyHelpers::Names::DebuggerOnlyProperties);
-            int length = PropertyHelpers::GetPropertyInt(properties, PropertyHelpers::Names::Length);
+            auto propertyPreview = PropertyPreview::create()
+                .setName(PropertyHelpers::GetPropertyString(prop, PropertyHelpers::Names::Name))
+                .setType(GetPreviewType(PropertyHelpers::GetPropertyString(prop, PropertyHelpers::Names::Type)))
+                .build();
 
-            for (int index = 0; index < length; index++)
+            String display;
+            if (PropertyHelpers::TryGetProperty(prop, PropertyHelpers::Names::Display, &display) ||
+                PropertyHelpers::TryGetProperty(prop, PropertyHelpers::Names::Value, &display))
             {
-                JsValueRef prop = PropertyHelpers::GetIndexedProperty(properties, index);
-                propertyDescriptors->addItem(ProtocolHelpers::WrapInternalProperty(prop));
+                if (display.length() > c_MaxPreviewValueLength)
+                {
+                    display = display.substring(0, c_MaxPreviewValueLength);
+                }
+
+                propertyPreview->setValue(display);
             }
+
+            propertyPreviews->addItem(std::move(propertyPreview));
         }
 
-        return propertyDescriptors;
+        auto preview = ObjectPreview::create()
+            .setType(remoteObject.getType())
+            .setOverflow((std::max)(length, total) > previewCount)
+            .setProperties(std::move(propertyPreviews))
+            .build();
+
+        if (remoteObject.hasSubtype())
+        {
+            preview->setSubtype(remoteObject.getSubtype(String()));
+        }
+
+        if (remoteObject.hasDescription())
+        {
+            preview->setDescription(remoteObject.getDescription(String()));
+        }
+
+        return preview;
+    }
+
+    std::unique_ptr<PropertyDescriptor> DebuggerObject::WrapProperty(JsValueRef property, bool generatePreview)
+    {
+        auto descriptor = ProtocolHelpers::WrapProperty(property);
+
+        if (generatePreview)
+        {
+            RemoteObject* value = descriptor->getValue(nullptr);
+            if (value != nullptr)
+            {
+                auto preview = DebuggerObject(property).GetPreview(*value);
+                if (preview != nullptr)
+                {
+                    value->setPreview(std::move(preview));
+                }
+            }
+        }
+
+        return descriptor;
+    }
+
+    void DebuggerObject::AddProperties(
+        Array<PropertyDescriptor>* descriptors,
+        JsValueRef properties,
+        int from,
+        int to,
+        bool generatePreview)
+    {
+        for (int index = from; index < to; index++)
+        {
+            JsValueRef prop = PropertyHelpers::GetIndexedProperty(properties, index);
+            descriptors->addItem(WrapProperty(prop, generatePreview));
+        }
+    }
+
+    JsValueRef DebuggerObject::GetDiagProperties(int from, int count) const
+    {
+        JsValueRef diagProperties = JS_INVALID_REFERENCE;
+        IfJsErrorThrow(JsDiagGetProperties(m_handle, from, count, &diagProperties));
+
+        return diagProperties;
+    }
+
+    String DebuggerObject::GetDiagPropertyName(int index, const String& defaultName) const
+    {
+        JsValueRef properties = PropertyHelpers::GetProperty(
+            GetDiagProperties(index, 1),
+            PropertyHelpers::Names::Properties);
+
+        return PropertyHelpers::GetPropertyInt(properties, PropertyHelpers::Names::Length) > 0
+            ? GetPropertyName(properties, 0)
+            : defaultName;
+    }
+
+    void DebuggerObject::AddBuckets(Array<PropertyDescriptor>* descriptors, int from, int count) const
+    {
+        // Buckets nest, so pick the smallest size that still keeps the number of buckets within the limit.
+        int64_t bucketSize = c_MaxBucketChildren;
+        while ((count + bucketSize - 1) / bucketSize > c_MaxBucketChildren)
+        {
+            bucketSize *= c_MaxBucketChildren;
+        }
+
+        // Buckets are labeled with the names of their first and last properties, which in a sparse array aren't their
+        // positions. The last property of each bucket is fetched together with the first property of the next one.
+        int end = from + count;
+        String firstName = GetDiagPropertyName(from, String::fromInteger(from));
+
+        for (int start = from; start < end; start += static_cast<int>(bucketSize))
+        {
+            int size = static_cast<int>((std::min)(bucketSize, static_cast<int64_t>(end - start)));
+            int last = start + size - 1;
+
+            JsValueRef boundaryProperties = PropertyHelpers::GetProperty(
+                GetDiagProperties(last, last + 1 < end ? 2 : 1),
+                PropertyHelpers::Names::Properties);
+            int boundaryLength = PropertyHelpers::GetPropertyInt(boundaryProperties, PropertyHelpers::Names::Length);
+
+            String lastName = boundaryLength > 0
+                ? GetPropertyName(boundaryProperties, 0)
+                : String::fromInteger(last);
+            String name = "[" + GetLabelName(firstName) + " ... " + GetLabelName(lastName) + "]";
+
+            firstName = boundaryLength > 1
+                ? GetPropertyName(boundaryProperties, 1)
+                : String::fromInteger(last + 1);
+
+            auto value = RemoteObject::create()
+                .setType("object")
+                .setDescription(name)
+                .setObjectId(ProtocolHelpers::GetObjectId(m_handle, start, size))
+                .build();
+
+            descriptors->addItem(PropertyDescriptor::create()
+                .setName(name)
+                .setValue(std::move(value))
+                .setWritable(false)
+                .setConfigurable(false)
+                .setEnumerable(true)
+                .build());
+        }
     }
 }
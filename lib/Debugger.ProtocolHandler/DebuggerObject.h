@@ -14,12 +14,35 @@ namespace JsDebug
     public:
         explicit DebuggerObject(JsValueRef obj);
 
-        virtual std::unique_ptr<protocol::Array<protocol::Runtime::PropertyDescriptor>>
-            GetPropertyDescriptors() const;
-        virtual std::unique_ptr<protocol::Array<protocol::Runtime::InternalPropertyDescriptor>>
-            GetInternalPropertyDescriptors() const;
+        virtual void GetPropertyDescriptors(
+            bool generatePreview,
+            std::unique_ptr<protocol::Array<protocol::Runtime::PropertyDescriptor>>* propertyDescriptors,
+            std::unique_ptr<protocol::Array<protocol::Runtime::InternalPropertyDescriptor>>* internalPropertyDescriptors)
+            const;
+
+        // Gets the properties at the given positions, as referenced by the object ID of a bucket.
+        std::unique_ptr<protocol::Array<protocol::Runtime::PropertyDescriptor>>
+            GetPropertyRangeDescriptors(int from, int count, bool generatePreview) const;
+
+        // Builds a preview of the object from its first few properties. Returns null for values that aren't objects.
+        std::unique_ptr<protocol::Runtime::ObjectPreview> GetPreview(
+            protocol::Runtime::RemoteObject& remoteObject) const;
 
     protected:
+        static std::unique_ptr<protocol::Runtime::PropertyDescriptor> WrapProperty(
+            JsValueRef property,
+            bool generatePreview);
+        static void AddProperties(
+            protocol::Array<protocol::Runtime::PropertyDescriptor>* descriptors,
+            JsValueRef properties,
+            int from,
+            int to,
+            bool generatePreview);
+
+        JsValueRef GetDiagProperties(int from, int count) const;
+        protocol::String GetDiagPropertyName(int index, const protocol::String& defaultName) const;
+        void AddBuckets(protocol::Array<protocol::Runtime::PropertyDescriptor>* descriptors, int from, int count) const;
+
         JsPersistent m_object;
         int m_handle;
     };
@@ -13,6 +13,11 @@ namespace JsDebug
 {
     using protocol::String;
 
+    namespace
+    {
+        const char c_ErrorInvalidPattern[] = "Invalid regular expression";
+    }
+
     DebuggerRegExp::DebuggerRegExp(
         Debugger* debugger,
         const String& pattern,
@@ -37,11 +42,22 @@ namespace JsDebug
 
         JsValueRef regExp = JS_INVALID_REFERENCE;
         std::array<JsValueRef, 3> args{ undefined, patternValue, flagsValue };
-        IfJsErrorThrow(JsConstructObject(
+        JsErrorCode err = JsConstructObject(
             regExpConstructor,
             args.data(),
             static_cast<unsigned short>(args.size()),
-            &regExp));
+            &regExp);
+
+        if (err == JsErrorScriptException)
+        {
+            // The pattern came from the frontend, so report it rather than leaving the SyntaxError pending.
+            JsValueRef exception = JS_INVALID_REFERENCE;
+            JsGetAndClearException(&exception);
+
+            throw JsErrorException(JsErrorInvalidArgument, c_ErrorInvalidPattern);
+        }
+
+        IfJsErrorThrow(err);
 
         m_regExp = regExp;
     }
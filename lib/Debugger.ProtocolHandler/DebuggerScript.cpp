@@ -9,6 +9,8 @@
 #include "ErrorHelpers.h"
 #include "PropertyHelpers.h"
 
+#include <algorithm>
+
 namespace JsDebug
 {
     using protocol::String;
@@ -33,6 +35,7 @@ namespace JsDebug
         : m_debugger(debugger)
         , m_scriptInfo(scriptInfo)
         , m_scriptId(0)
+        , m_isBlackboxed(false)
     {
         if (!m_scriptInfo.IsEmpty())
         {
@@ -139,6 +142,52 @@ namespace JsDebug
         return false;
     }
 
+    bool DebuggerScript::IsBlackboxed() const
+    {
+        return m_isBlackboxed;
+    }
+
+    void DebuggerScript::SetBlackboxed(bool isBlackboxed)
+    {
+        m_isBlackboxed = isBlackboxed;
+    }
+
+    bool DebuggerScript::IsBlackboxedAt(int lineNumber, int columnNumber) const
+    {
+        if (m_isBlackboxed)
+        {
+            return true;
+        }
+
+        if (m_blackboxedRangeBoundaries.empty())
+        {
+            return false;
+        }
+
+        auto it = std::upper_bound(
+            m_blackboxedRangeBoundaries.begin(),
+            m_blackboxedRangeBoundaries.end(),
+            EncodePosition(lineNumber, columnNumber));
+
+        return (std::distance(m_blackboxedRangeBoundaries.begin(), it) % 2) == 1;
+    }
+
+    void DebuggerScript::SetBlackboxedRanges(const std::vector<std::pair<int, int>>& positions)
+    {
+        m_blackboxedRangeBoundaries.clear();
+        m_blackboxedRangeBoundaries.reserve(positions.size());
+
+        for (const auto& position : positions)
+        {
+            m_blackboxedRangeBoundaries.push_back(EncodePosition(position.first, position.second));
+        }
+    }
+
+    int64_t DebuggerScript::EncodePosition(int lineNumber, int columnNumber)
+    {
+        return (static_cast<int64_t>(lineNumber) << 32) | static_cast<uint32_t>(columnNumber);
+    }
+
     void DebuggerScript::ParseScriptSource()
     {
         DebuggerRegExp regExp(m_debugger, c_SourceInfoCommentPattern, c_SourceInfoCommentFlags);
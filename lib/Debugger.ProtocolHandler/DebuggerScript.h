@@ -8,6 +8,10 @@
 #include <StringUtil.h>
 #include <ChakraCore.h>
 
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 namespace JsDebug
 {
     class Debugger;
@@ -32,7 +36,17 @@ namespace JsDebug
         protocol::String ExecutionContextAuxData() const;
         bool IsLiveEdit() const;
 
+        bool IsBlackboxed() const;
+        void SetBlackboxed(bool isBlackboxed);
+        bool IsBlackboxedAt(int lineNumber, int columnNumber) const;
+
+        // Positions are pairs of (line, column) which must be sorted. Every even position starts a blackboxed range
+        // and the following odd position ends it.
+        void SetBlackboxedRanges(const std::vector<std::pair<int, int>>& positions);
+
     private:
+        static int64_t EncodePosition(int lineNumber, int columnNumber);
+
         void ParseScriptSource();
 
         Debugger* m_debugger;
@@ -43,5 +57,11 @@ namespace JsDebug
         protocol::String m_sourceUrl;
         protocol::String m_sourceMappingUrl;
         protocol::String m_hash;
+
+        bool m_isBlackboxed;
+
+        // Sorted range boundaries, so a position is inside a blackboxed range when an odd number of boundaries
+        // precede it. This keeps the check on each step to a single binary search.
+        std::vector<int64_t> m_blackboxedRangeBoundaries;
     };
 }
@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+#include "ObjectGroups.h"
+
+#include "PropertyHelpers.h"
+
+namespace JsDebug
+{
+    using protocol::String;
+
+    ObjectGroups::ObjectGroups()
+    {
+    }
+
+    void ObjectGroups::Add(const String& group, JsValueRef object)
+    {
+        int handle = 0;
+        if (!PropertyHelpers::TryGetProperty(object, PropertyHelpers::Names::Handle, &handle))
+        {
+            return;
+        }
+
+        // An object that is requested again belongs to the group it was first added to.
+        if (m_objects.emplace(handle, Entry { JsPersistent(object), group }).second)
+        {
+            m_groups[group].push_back(handle);
+        }
+
+        m_releasedHandles.erase(handle);
+    }
+
+    bool ObjectGroups::TryGet(int handle, JsValueRef* object) const
+    {
+        auto it = m_objects.find(handle);
+        if (it == m_objects.end())
+        {
+            return false;
+        }
+
+        *object = it->second.object.Get();
+        return true;
+    }
+
+    bool ObjectGroups::TryGetGroup(int handle, String* group) const
+    {
+        auto it = m_objects.find(handle);
+        if (it == m_objects.end())
+        {
+            return false;
+        }
+
+        *group = it->second.group;
+        return true;
+    }
+
+    bool ObjectGroups::IsReleased(int handle) const
+    {
+        return m_releasedHandles.find(handle) != m_releasedHandles.end();
+    }
+
+    bool ObjectGroups::Release(int handle)
+    {
+        // The handle is left in its group's list, which is only cleaned up when the whole group is released.
+        if (m_objects.erase(handle) == 0)
+        {
+            return false;
+        }
+
+        m_releasedHandles.insert(handle);
+        return true;
+    }
+
+    void ObjectGroups::ReleaseGroup(const String& group)
+    {
+        auto it = m_groups.find(group);
+        if (it == m_groups.end())
+        {
+            return;
+        }
+
+        for (int handle : it->second)
+        {
+            // Skip handles that were released on their own and then added again to another group.
+            auto entry = m_objects.find(handle);
+            if (entry != m_objects.end() && entry->second.group == group)
+            {
+                m_objects.erase(entry);
+                m_releasedHandles.insert(handle);
+            }
+        }
+
+        m_groups.erase(it);
+    }
+
+    void ObjectGroups::Clear()
+    {
+        m_objects.clear();
+        m_groups.clear();
+        m_releasedHandles.clear();
+    }
+
+    size_t ObjectGroups::GetObjectCount() const
+    {
+        return m_objects.size();
+    }
+}
@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "JsPersistent.h"
+
+#include <protocol/Runtime.h>
+#include <ChakraCore.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace JsDebug
+{
+    // Keeps the objects handed out to the frontend during a pause, grouped by the object group they were requested
+    // with. The engine objects are kept alive by their entries, so lookups don't have to go back to the engine, and
+    // releasing a group drops all of its entries at once. Handles are only valid while paused, so everything is cleared
+    // on resume.
+    class ObjectGroups
+    {
+    public:
+        ObjectGroups();
+        ObjectGroups(const ObjectGroups&) = delete;
+        ObjectGroups& operator=(const ObjectGroups&) = delete;
+
+        // Adds a debugger object, as returned by the JsDiag APIs. Objects without a handle are ignored.
+        void Add(const protocol::String& group, JsValueRef object);
+
+        // Returns false if the handle isn't in any group, in which case it has to be looked up in the engine.
+        bool TryGet(int handle, JsValueRef* object) const;
+        bool TryGetGroup(int handle, protocol::String* group) const;
+        bool IsReleased(int handle) const;
+
+        // Returns false if the handle isn't in any group.
+        bool Release(int handle);
+        void ReleaseGroup(const protocol::String& group);
+        void Clear();
+
+        size_t GetObjectCount() const;
+
+    private:
+        struct Entry
+        {
+            JsPersistent object;
+            protocol::String group;
+        };
+
+        std::unordered_map<int, Entry> m_objects;
+        std::unordered_map<protocol::String, std::vector<int>> m_groups;
+
+        // Released handles stay invalid for the rest of the pause, even though the engine would still resolve them.
+        std::unordered_set<int> m_releasedHandles;
+    };
+}
@@ -151,6 +151,29 @@ namespace JsDebug
         return hasProperty;
     }
 
+    JsValueRef PropertyHelpers::GetOwnPropertyDescriptor(JsValueRef object, JsValueRef name, String16* nameString)
+    {
+        size_t nameLength = 0;
+        IfJsErrorThrow(JsCopyString(name, nullptr, 0, &nameLength));
+
+        std::vector<char> buffer(nameLength);
+        IfJsErrorThrow(JsCopyString(name, buffer.data(), buffer.size(), nullptr));
+
+        JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+        IfJsErrorThrow(JsCreatePropertyId(buffer.data(), buffer.size(), &propertyId));
+
+        JsValueRef descriptor = JS_INVALID_REFERENCE;
+        IfJsErrorThrow(JsGetOwnPropertyDescriptor(object, propertyId, &descriptor));
+
+        *nameString = String16::fromUtf8(buffer.data(), buffer.size());
+        return descriptor;
+    }
+
+    String16 PropertyHelpers::ValueToString(JsValueRef value)
+    {
+        return ValueAsString</*doConversion*/true>(value);
+    }
+
     bool PropertyHelpers::TryGetProperty(JsValueRef object, const char* name, JsValueRef* value)
     {
         JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
@@ -16,20 +16,28 @@ namespace JsDebug
             constexpr char BreakpointId[] = "breakpointId";
             constexpr char ClassName[] = "className";
             constexpr char Column[] = "column";
+            constexpr char Configurable[] = "configurable";
+            constexpr char Count[] = "count";
             constexpr char DebuggerOnlyProperties[] = "debuggerOnlyProperties";
             constexpr char Display[] = "display";
+            constexpr char Enumerable[] = "enumerable";
+            constexpr char Error[] = "Error";
             constexpr char Exception[] = "exception";
             constexpr char Exec[] = "exec";
             constexpr char FileName[] = "fileName";
+            constexpr char From[] = "from";
             constexpr char FunctionCallsReturn[] = "functionCallsReturn";
             constexpr char FunctionHandle[] = "functionHandle";
+            constexpr char Get[] = "get";
             constexpr char Globals[] = "globals";
             constexpr char Handle[] = "handle";
+            constexpr char Id[] = "id";
             constexpr char Index[] = "index";
             constexpr char Length[] = "length";
             constexpr char Line[] = "line";
             constexpr char LineCount[] = "lineCount";
             constexpr char Locals[] = "locals";
+            constexpr char Message[] = "message";
             constexpr char Name[] = "name";
             constexpr char Ordinal[] = "ordinal";
             constexpr char Properties[] = "properties";
@@ -39,12 +47,16 @@ namespace JsDebug
             constexpr char ScriptId[] = "scriptId";
             constexpr char ScriptType[] = "scriptType";
             constexpr char Scopes[] = "scopes";
+            constexpr char Set[] = "set";
             constexpr char Source[] = "source";
+            constexpr char Stack[] = "stack";
             constexpr char Test[] = "test";
             constexpr char ThisObject[] = "thisObject";
+            constexpr char TotalPropertiesOfObject[] = "totalPropertiesOfObject";
             constexpr char Type[] = "type";
             constexpr char Uncaught[] = "uncaught";
             constexpr char Value[] = "value";
+            constexpr char Writable[] = "writable";
         }
 
         JsValueRef GetProperty(JsValueRef object, const char* name);
@@ -63,6 +75,12 @@ namespace JsDebug
 
         bool HasProperty(JsValueRef object, const char* name);
 
+        // Gets the descriptor of an own property, given one of the names returned by JsGetOwnPropertyNames.
+        JsValueRef GetOwnPropertyDescriptor(JsValueRef object, JsValueRef name, String16* nameString);
+
+        // Converts any value to a string, which may call into script.
+        String16 ValueToString(JsValueRef value);
+
         bool TryGetProperty(JsValueRef object, const char* name, JsValueRef* value);
         bool TryGetProperty(JsValueRef object, const char* name, bool* value);
         bool TryGetProperty(JsValueRef object, const char* name, int* value);
@@ -5,6 +5,7 @@
 #include "ChakraDebugProtocolHandler.h"
 #include "ProtocolHandler.h"
 #include <cassert>
+#include <cstring>
 
 namespace JsDebug
 {
@@ -20,6 +21,158 @@ namespace JsDebug
         const char c_ErrorHandlerAlreadyConnected[] = "Handler is already connected";
         const char c_ErrorInvalidCallbackState[] = "'callbackState' can only be provided with a valid callback";
         const char c_ErrorNoHandlerConnected[] = "No handler is currently connected";
+
+        // Recording is always on, so at most this many messages are kept, and each is cut down to roughly this many
+        // characters of arguments.
+        const size_t c_MaxConsoleMessages = 256;
+        const size_t c_MaxConsoleMessageLength = 4096;
+
+        // The only execution context reported to the frontend, see RuntimeImpl.
+        const int c_ExecutionContextId = 1;
+
+        const char c_MethodKey[] = "method";
+
+        // Read-only requests that can take a while to answer. They wait until every other queued command has been
+        // handled, so they can't hold up a resume or step, or anything that has to happen before one.
+        const char* const c_InspectionMethods[] =
+        {
+            "Debugger.evaluateExpressionsOnCallFrame",
+            "Debugger.evaluateOnCallFrame",
+            "Debugger.getScriptSource",
+            "Runtime.callFunctionOn",
+            "Runtime.evaluate",
+            "Runtime.getProperties",
+        };
+
+        const char* SkipWhitespace(const char* current)
+        {
+            while (*current == ' ' || *current == '\t' || *current == '\r' || *current == '\n')
+            {
+                ++current;
+            }
+
+            return current;
+        }
+
+        // Takes the position of an opening quote and returns the one after the closing quote, or null if the string
+        // isn't terminated.
+        const char* SkipString(const char* current)
+        {
+            ++current;
+            while (*current != '\0' && *current != '"')
+            {
+                if (*current == '\\' && current[1] != '\0')
+                {
+                    ++current;
+                }
+
+                ++current;
+            }
+
+            return *current == '"' ? current + 1 : nullptr;
+        }
+
+        // Finds the "method" member of the top-level object without building the whole message. Nested objects, arrays
+        // and strings are skipped whole, so nothing inside "params" can be mistaken for it.
+        bool TryGetMethod(const char* command, const char** method, size_t* length)
+        {
+            const char* current = SkipWhitespace(command);
+            if (*current++ != '{')
+            {
+                return false;
+            }
+
+            int depth = 0;
+            bool expectingKey = true;
+
+            while (*current != '\0')
+            {
+                if (*current == '"')
+                {
+                    const char* key = current + 1;
+                    const char* end = SkipString(current);
+                    if (end == nullptr)
+                    {
+                        return false;
+                    }
+
+                    current = end;
+                    if (depth != 0 || !expectingKey)
+                    {
+                        continue;
+                    }
+
+                    expectingKey = false;
+                    current = SkipWhitespace(current);
+                    if (*current++ != ':')
+                    {
+                        return false;
+                    }
+
+                    size_t keyLength = static_cast<size_t>(end - 1 - key);
+                    if (keyLength != sizeof(c_MethodKey) - 1 || std::strncmp(key, c_MethodKey, keyLength) != 0)
+                    {
+                        continue;
+                    }
+
+                    current = SkipWhitespace(current);
+                    if (*current != '"' || (end = SkipString(current)) == nullptr)
+                    {
+                        return false;
+                    }
+
+                    *method = current + 1;
+                    *length = static_cast<size_t>(end - 1 - *method);
+                    return true;
+                }
+
+                switch (*current)
+                {
+                case '{':
+                case '[':
+                    ++depth;
+                    break;
+                case '}':
+                case ']':
+                    if (depth-- == 0)
+                    {
+                        return false;
+                    }
+                    break;
+                case ',':
+                    expectingKey = depth == 0;
+                    break;
+                default:
+                    break;
+                }
+
+                ++current;
+            }
+
+            return false;
+        }
+
+        // Anything that can't be classified is treated as a regular command, and the dispatcher will report the error
+        // when it is handled.
+        bool IsInspectionCommand(const char* command)
+        {
+            const char* method = nullptr;
+            size_t length = 0;
+            if (!TryGetMethod(command, &method, &length))
+            {
+                return false;
+            }
+
+            for (const char* inspectionMethod : c_InspectionMethods)
+            {
+                if (std::strlen(inspectionMethod) == length && std::strncmp(inspectionMethod, method, length) == 0)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
     }
 
     ProtocolHandler::ProtocolHandler(JsRuntimeHandle runtime)
@@ -28,9 +181,14 @@ namespace JsDebug
         , m_commandQueueCallback(nullptr)
         , m_commandQueueCallbackState(nullptr)
         , m_consoleHandler(this)
+        , m_consoleMessages(c_MaxConsoleMessages, c_MaxConsoleMessageLength, c_ExecutionContextId)
+        , m_session(0)
+        , m_connectedSession(0)
         , m_isConnected(false)
         , m_waitingForDebugger(false)
         , m_breakOnNextLine(false)
+        , m_asyncBreakPending(false)
+        , m_isHandlingCommand(false)
         , m_dispatcher(this)
     {
         if (runtime == nullptr) {
@@ -70,10 +228,17 @@ namespace JsDebug
             m_sendResponseCallbackState = callbackState;
             m_breakOnNextLine = breakOnNextLine;
 
-            EnqueueCommand(CommandType::Connect);
+            // Connecting and disconnecting stay in order with the regular commands, so everything a client sent is
+            // handled while it's still the connected one.
+            int session = ++m_session;
+            if (m_commandQueue.Push(CommandType::Connect, session))
+            {
+                m_commandWaiting.notify_all();
+                m_waitHandle.Signal();
+            }
         }
 
-        m_debugger->RequestAsyncBreak();
+        RequestAsyncBreak();
     }
 
     void ProtocolHandler::Disconnect()
@@ -90,10 +255,16 @@ namespace JsDebug
             m_sendResponseCallbackState = nullptr;
             m_breakOnNextLine = false;
 
-            EnqueueCommand(CommandType::Disconnect);
+            // Commands from this client that haven't been handled yet no longer have anyone to answer to.
+            int session = m_session++;
+            if (m_commandQueue.Push(CommandType::Disconnect, session))
+            {
+                m_commandWaiting.notify_all();
+                m_waitHandle.Signal();
+            }
         }
 
-        m_debugger->RequestAsyncBreak();
+        RequestAsyncBreak();
     }
 
     void ProtocolHandler::SendCommand(const char* command)
@@ -109,31 +280,42 @@ namespace JsDebug
         OutputDebugStringA("},\r\n");
 #endif
 
-        ProtocolHandlerCommandQueueCallback callback = nullptr;
-        void* state = nullptr;
+        // Every other command stays in order with the connect and disconnect, so an inspection request that is held
+        // back is still handled after the connect that it depends on.
+        int session = m_session.load();
+        CommandQueue& queue = IsInspectionCommand(command) ? m_inspectionQueue : m_commandQueue;
 
+        // Only the first command added to an empty queue needs to wake the script thread, any that follow will be
+        // picked up by the same pass over the queue.
+        if (queue.Push(CommandType::MessageReceived, session, command))
         {
-            std::unique_lock<std::mutex> lock(m_lock);
-            EnqueueCommand(CommandType::MessageReceived, command);
-
-            callback = m_commandQueueCallback;
-            state = m_commandQueueCallbackState;
+            NotifyCommandWaiting();
         }
-        
-        // Trigger a debugger break
-        m_debugger->RequestAsyncBreak();
+    }
 
-        if (callback != nullptr)
+    void ProtocolHandler::WaitForDebugger()
+    {
+        m_waitingForDebugger = true;
+        ProcessCommands(nullptr);
+    }
+
+    bool ProtocolHandler::WaitForDebugger(std::chrono::milliseconds timeout)
+    {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        m_waitingForDebugger = true;
+        if (!ProcessCommands(&deadline))
         {
-            // Notify the host
-            callback(state);
+            m_waitingForDebugger = false;
+            return false;
         }
+
+        return true;
     }
 
-    void ProtocolHandler::WaitForDebugger()
+    JsDebugWaitHandle ProtocolHandler::GetCommandWaitHandle() const
     {
-        m_waitingForDebugger = true;
-        ProcessCommandQueue();
+        return m_waitHandle.GetHandle();
     }
 
     void ProtocolHandler::RunIfWaitingForDebugger()
@@ -141,6 +323,11 @@ namespace JsDebug
         m_waitingForDebugger = false;
     }
 
+    JsContextRef ProtocolHandler::GetHostContext() const
+    {
+        return m_hostContext.Get();
+    }
+
     JsValueRef ProtocolHandler::CreateConsoleObject()
     {
         JsContextRef currentContext = JS_INVALID_REFERENCE;
@@ -155,12 +342,55 @@ namespace JsDebug
         return m_consoleHandler.CreateConsoleObject();
     }
 
+    void ProtocolHandler::AsyncTaskScheduled(void* task, const char* description)
+    {
+        m_debugger->AsyncTaskScheduled(task, description);
+    }
+
+    void ProtocolHandler::AsyncTaskStarted(void* task)
+    {
+        m_debugger->AsyncTaskStarted(task);
+    }
+
+    void ProtocolHandler::AsyncTaskFinished(void* task)
+    {
+        m_debugger->AsyncTaskFinished(task);
+    }
+
     void ProtocolHandler::ConsoleAPICalled(protocol::String& apiType, JsValueRef *arguments, size_t argumentCount)
     {
-        if (m_isConnected)
+        // Like the browsers, console.clear() drops what was logged before it.
+        if (apiType == protocol::Runtime::ConsoleAPICalled::TypeEnum::Clear)
         {
-            m_runtimeAgent->consoleAPICalled(apiType, arguments, argumentCount);
+            m_consoleMessages.Clear();
         }
+
+        // Arguments are wrapped once. An attached frontend gets them by reference, and the kept message reuses them.
+        auto args = m_isConnected ? m_runtimeAgent->WrapConsoleArguments(arguments, argumentCount) : nullptr;
+        if (args == nullptr)
+        {
+            m_consoleMessages.Add(apiType, arguments, argumentCount);
+            return;
+        }
+
+        protocol::String notification;
+        m_consoleMessages.Add(apiType, *args, &notification);
+        sendProtocolNotification(protocol::SerializedValue::create(notification));
+    }
+
+    void ProtocolHandler::ReplayConsoleMessages()
+    {
+        m_consoleMessages.Replay(this);
+    }
+
+    void ProtocolHandler::ClearConsoleMessages()
+    {
+        m_consoleMessages.Clear();
+    }
+
+    void ProtocolHandler::SetTimeTravelReplay(bool isReplay)
+    {
+        m_debugger->SetTimeTravelReplay(isReplay);
     }
 
     std::unique_ptr<Array<Domain>> ProtocolHandler::GetSupportedDomains()
@@ -182,6 +412,11 @@ namespace JsDebug
             .setVersion(protocol::Runtime::Metainfo::version)
             .build());
 
+        domains->addItem(Domain::create()
+            .setName(protocol::TimeTravel::Metainfo::domainName)
+            .setVersion(protocol::TimeTravel::Metainfo::version)
+            .build());
+
         return domains;
     }
 
@@ -211,53 +446,225 @@ namespace JsDebug
 
     void ProtocolHandler::ProcessCommandQueue()
     {
+        // Script run by a command raises debug events, which would otherwise handle the commands queued after it
+        // before it has finished. Pausing still processes commands through WaitForDebugger.
+        if (m_isHandlingCommand)
+        {
+            return;
+        }
+
+        ProcessCommands(nullptr);
+    }
+
+    size_t ProtocolHandler::ProcessCommandQueue(size_t maxCommands, std::chrono::milliseconds timeBudget)
+    {
+        // Same as above, the commands queued behind the one being handled are left for a later call.
+        if (m_isHandlingCommand)
+        {
+            return m_commandQueue.GetSize() + m_inspectionQueue.GetSize();
+        }
+
         // Ensure that there's an active context before trying to process the queue.
         DebuggerContext::Scope debuggerScope(*m_debugger->GetDebugContext());
+        UpdateHostContext(debuggerScope);
 
-        std::vector<std::pair<CommandType, std::string>> current;
+        auto deadline = std::chrono::steady_clock::now() + timeBudget;
+        size_t handled = 0;
 
-        do
+        // Always handle at least one command when allowed, so that a small time budget still makes progress.
+        auto canContinue = [&]()
         {
-            current.clear();
+            return handled < maxCommands && (handled == 0 || std::chrono::steady_clock::now() < deadline);
+        };
 
+        auto handleCommand = [&](CommandType type, int session, const std::string& message)
+        {
+            ++handled;
+            HandleCommand(type, session, message);
+        };
+
+        m_asyncBreakPending = false;
+        m_waitHandle.Reset();
+
+        while (canContinue())
+        {
+            // Regular commands, including any that arrived while the last command was handled, go first. Inspection
+            // requests are taken one at a time so that the budget is checked again before each of them.
+            if (!m_commandQueue.IsEmpty())
+            {
+                m_commandQueue.Drain(handleCommand, canContinue);
+                continue;
+            }
+
+            size_t taken = 0;
+            if (m_inspectionQueue.Drain(handleCommand, [&]() { return taken++ == 0; }) == 0)
+            {
+                break;
+            }
+        }
+
+        size_t remaining = m_commandQueue.GetSize() + m_inspectionQueue.GetSize();
+        if (remaining > 0)
+        {
+            // Pushing onto a queue that isn't empty doesn't ask for a break or signal the handle, so do both again
+            // for the commands left over. Otherwise a host that only waits for either would never come back for them.
+            m_waitHandle.Signal();
+            RequestAsyncBreak();
+        }
+
+        return remaining;
+    }
+
+    bool ProtocolHandler::ProcessCommands(const std::chrono::steady_clock::time_point* deadline)
+    {
+        // Ensure that there's an active context before trying to process the queue.
+        DebuggerContext::Scope debuggerScope(*m_debugger->GetDebugContext());
+        UpdateHostContext(debuggerScope);
+
+        size_t processed = 0;
+
+        do
+        {
+            if (m_waitingForDebugger)
             {
                 std::unique_lock<std::mutex> lock(m_lock);
 
-                if (m_waitingForDebugger && m_commandQueue.empty())
+                if (m_commandQueue.IsEmpty() && m_inspectionQueue.IsEmpty())
                 {
-                    m_commandWaiting.wait(lock);
+                    if (deadline == nullptr)
+                    {
+                        m_commandWaiting.wait(lock);
+                    }
+                    else if (m_commandWaiting.wait_until(lock, *deadline) == std::cv_status::timeout &&
+                        m_commandQueue.IsEmpty() && m_inspectionQueue.IsEmpty())
+                    {
+                        return false;
+                    }
                 }
-
-                std::swap(m_commandQueue, current);
             }
 
-            for (const auto& command : current)
+            // Clear the flag and the wait handle before taking the queue so that anything pushed from here on requests
+            // a new break and signals the handle again.
+            m_asyncBreakPending = false;
+            m_waitHandle.Reset();
+
+            processed = DrainCommandQueue();
+            processed += m_inspectionQueue.Drain([this](CommandType type, int session, const std::string& message)
             {
-                switch (command.first)
-                {
-                case CommandType::Connect:
-                    HandleConnect();
-                    break;
+                // Let regular commands that arrived in the meantime go ahead of the rest of the inspection requests.
+                DrainCommandQueue();
+                HandleCommand(type, session, message);
+            });
+        } while (m_waitingForDebugger || processed > 0);
 
-                case CommandType::Disconnect:
-                    HandleDisconnect();
-                    break;
+        return true;
+    }
 
-                case CommandType::MessageReceived:
-                    HandleMessageReceived(command.second);
-                    break;
+    size_t ProtocolHandler::DrainCommandQueue()
+    {
+        return m_commandQueue.Drain([this](CommandType type, int session, const std::string& message)
+        {
+            HandleCommand(type, session, message);
+        });
+    }
 
-                default:
-                    throw std::runtime_error("Unknown command type");
-                }
+    void ProtocolHandler::NotifyCommandWaiting()
+    {
+        ProtocolHandlerCommandQueueCallback callback = nullptr;
+        void* state = nullptr;
+
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+            m_commandWaiting.notify_all();
+            m_waitHandle.Signal();
+
+            callback = m_commandQueueCallback;
+            state = m_commandQueueCallbackState;
+        }
+
+        // Trigger a debugger break
+        RequestAsyncBreak();
+
+        if (callback != nullptr)
+        {
+            // Notify the host
+            callback(state);
+        }
+    }
+
+    void ProtocolHandler::RequestAsyncBreak()
+    {
+        // One break drains everything that has been queued, so only ask the engine again once it has been handled.
+        if (m_asyncBreakPending.exchange(true))
+        {
+            return;
+        }
+
+        try
+        {
+            m_debugger->RequestAsyncBreak();
+        }
+        catch (...)
+        {
+            m_asyncBreakPending = false;
+            throw;
+        }
+    }
+
+    void ProtocolHandler::UpdateHostContext(const DebuggerContext::Scope& scope)
+    {
+        // Nested processing, such as while paused, starts out in the debugger's context rather than the host's.
+        JsContextRef previousContext = scope.GetPreviousContext();
+        if (previousContext != JS_INVALID_REFERENCE &&
+            previousContext != m_debugger->GetDebugContext()->GetContext() &&
+            previousContext != m_hostContext.Get())
+        {
+            m_hostContext = previousContext;
+
+            if (m_runtimeAgent != nullptr)
+            {
+                m_runtimeAgent->HostContextChanged();
             }
-        } while (m_waitingForDebugger || !current.empty());
+        }
     }
 
-    void ProtocolHandler::EnqueueCommand(ProtocolHandler::CommandType type, const std::string& message)
+    void ProtocolHandler::HandleCommand(CommandType type, int session, const std::string& message)
     {
-        m_commandQueue.emplace_back(type, message);
-        m_commandWaiting.notify_all();
+        bool wasHandlingCommand = m_isHandlingCommand;
+        m_isHandlingCommand = true;
+
+        try
+        {
+            DispatchCommand(type, session, message);
+        }
+        catch (...)
+        {
+            m_isHandlingCommand = wasHandlingCommand;
+            throw;
+        }
+
+        m_isHandlingCommand = wasHandlingCommand;
+    }
+
+    void ProtocolHandler::DispatchCommand(CommandType type, int session, const std::string& message)
+    {
+        switch (type)
+        {
+        case CommandType::Connect:
+            HandleConnect(session);
+            break;
+
+        case CommandType::Disconnect:
+            HandleDisconnect();
+            break;
+
+        case CommandType::MessageReceived:
+            HandleMessageReceived(session, message);
+            break;
+
+        default:
+            throw std::runtime_error("Unknown command type");
+        }
     }
 
     void ProtocolHandler::SendResponse(const char* response)
@@ -268,7 +675,7 @@ namespace JsDebug
         }
     }
 
-    void ProtocolHandler::HandleConnect()
+    void ProtocolHandler::HandleConnect(int session)
     {
         if (m_isConnected)
         {
@@ -287,12 +694,16 @@ namespace JsDebug
         m_schemaAgent = std::make_unique<SchemaImpl>(this, this);
         protocol::Schema::Dispatcher::wire(&m_dispatcher, m_schemaAgent.get());
 
+        m_timeTravelAgent = std::make_unique<TimeTravelImpl>(m_debugger.get());
+        protocol::TimeTravel::Dispatcher::wire(&m_dispatcher, m_timeTravelAgent.get());
+
         if (m_breakOnNextLine)
         {
             m_debugger->PauseOnNextStatement();
         }
 
         m_isConnected = true;
+        m_connectedSession = session;
     }
 
     void ProtocolHandler::HandleDisconnect()
@@ -302,17 +713,29 @@ namespace JsDebug
             throw std::runtime_error("Not currently connected");
         }
 
+        // Release what the frontend was holding on to while the debugger context is still current.
+        m_runtimeAgent->disable();
+
         m_consoleAgent.reset();
         m_debuggerAgent.reset();
         m_runtimeAgent.reset();
         m_schemaAgent.reset();
+        m_timeTravelAgent.reset();
 
         RunIfWaitingForDebugger();
         m_isConnected = false;
+        m_connectedSession = 0;
     }
 
-    void ProtocolHandler::HandleMessageReceived(const std::string& message)
+    void ProtocolHandler::HandleMessageReceived(int session, const std::string& message)
     {
+        if (!m_isConnected || session != m_connectedSession.load() || session != m_session.load())
+        {
+            // The client that sent this has disconnected, so its responses would otherwise go to whoever connected
+            // next.
+            return;
+        }
+
         protocol::String messageStr = protocol::String::fromUtf8(message.c_str(), message.length());
         m_dispatcher.dispatch(protocol::StringUtil::parseJSON(messageStr));
     }
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include "CommandQueue.h"
+#include "CommandWaitHandle.h"
 #include "Debugger.h"
 
 #include "protocol\Forward.h"
@@ -12,10 +14,14 @@
 #include "DebuggerImpl.h"
 #include "RuntimeImpl.h"
 #include "SchemaImpl.h"
+#include "TimeTravelImpl.h"
 
 #include <ChakraCore.h>
 
 #include "ConsoleHandler.h"
+#include "ConsoleMessages.h"
+#include <atomic>
+#include <chrono>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -39,11 +45,28 @@ namespace JsDebug
         void SendCommand(const char* command);
         void SetCommandQueueCallback(ProtocolHandlerCommandQueueCallback callback, void* callbackState);
         void ProcessCommandQueue();
+        size_t ProcessCommandQueue(size_t maxCommands, std::chrono::milliseconds timeBudget);
         void WaitForDebugger();
+        bool WaitForDebugger(std::chrono::milliseconds timeout);
+        JsDebugWaitHandle GetCommandWaitHandle() const;
         void RunIfWaitingForDebugger();
 
+        // The context the host had set when commands were last processed, which is where scripts from the frontend
+        // run when not paused. Commands themselves run in the debugger's own context.
+        JsContextRef GetHostContext() const;
+
         void ConsoleAPICalled(protocol::String& apiType, JsValueRef *arguments, size_t argumentCount);
         JsValueRef CreateConsoleObject();
+
+        // Console messages are recorded even while no frontend is connected, and are sent again when one enables the
+        // runtime domain.
+        void ReplayConsoleMessages();
+        void ClearConsoleMessages();
+
+        void AsyncTaskScheduled(void* task, const char* description);
+        void AsyncTaskStarted(void* task);
+        void AsyncTaskFinished(void* task);
+        void SetTimeTravelReplay(bool isReplay);
         std::unique_ptr<protocol::Array<protocol::Schema::Domain>> GetSupportedDomains();
 
         // protocol::FrontendChannel implementation
@@ -52,19 +75,17 @@ namespace JsDebug
         void flushProtocolNotifications() override;
 
     private:
-        enum class CommandType
-        {
-            None,
-            Connect,
-            Disconnect,
-            MessageReceived,
-        };
-
         void SendResponse(const char* response);
-        void EnqueueCommand(CommandType type, const std::string& message = "");
-        void HandleConnect();
+        bool ProcessCommands(const std::chrono::steady_clock::time_point* deadline);
+        size_t DrainCommandQueue();
+        void NotifyCommandWaiting();
+        void RequestAsyncBreak();
+        void HandleCommand(CommandType type, int session, const std::string& message);
+        void DispatchCommand(CommandType type, int session, const std::string& message);
+        void HandleConnect(int session);
         void HandleDisconnect();
-        void HandleMessageReceived(const std::string& message);
+        void HandleMessageReceived(int session, const std::string& message);
+        void UpdateHostContext(const DebuggerContext::Scope& scope);
 
         std::unique_ptr<Debugger> m_debugger;
         ProtocolHandlerSendResponseCallback m_sendResponseCallback;
@@ -74,21 +95,32 @@ namespace JsDebug
 
         std::mutex m_lock;
         std::condition_variable m_commandWaiting;
-        std::vector<std::pair<CommandType, std::string>> m_commandQueue;
+        CommandWaitHandle m_waitHandle;
+        CommandQueue m_commandQueue;
+        CommandQueue m_inspectionQueue;
         ConsoleHandler m_consoleHandler;
+        ConsoleMessages m_consoleMessages;
 #if DBG
         // This is for debug purpose to understand how many times the console object fetched.
         int m_consoleObjectCount;
 #endif
+        // Every connect and disconnect starts a new session, and commands are tagged with the one they were sent in.
+        // The connected session is the one the script thread has handled the connect for.
+        std::atomic<int> m_session;
+        std::atomic<int> m_connectedSession;
         bool m_isConnected;
         bool m_waitingForDebugger;
         bool m_breakOnNextLine;
+        std::atomic<bool> m_asyncBreakPending;
+        bool m_isHandlingCommand;
+        JsPersistent m_hostContext;
 
         protocol::UberDispatcher m_dispatcher;
         std::unique_ptr<ConsoleImpl> m_consoleAgent;
         std::unique_ptr<DebuggerImpl> m_debuggerAgent;
         std::unique_ptr<RuntimeImpl> m_runtimeAgent;
         std::unique_ptr<SchemaImpl> m_schemaAgent;
+        std::unique_ptr<TimeTravelImpl> m_timeTravelAgent;
     };
 
 }
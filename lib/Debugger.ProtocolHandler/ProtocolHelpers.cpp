@@ -6,13 +6,22 @@
 #include "PropertyHelpers.h"
 #include "ErrorHelpers.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
 namespace JsDebug
 {
     using protocol::DictionaryValue;
     using protocol::Debugger::Location;
     using protocol::Runtime::ExceptionDetails;
     using protocol::Runtime::InternalPropertyDescriptor;
+    using protocol::Runtime::ObjectPreview;
     using protocol::Runtime::PropertyDescriptor;
+    using protocol::Runtime::PropertyPreview;
     using protocol::Runtime::RemoteObject;
     using protocol::String;
     using protocol::StringUtil;
@@ -25,10 +34,630 @@ namespace JsDebug
         const char c_ErrorNoDisplayString[] = "No display string found";
         const int c_JsrtDebugPropertyReadOnly = 0x4;
 
-        std::unique_ptr<Value> ToProtocolValue(JsValueRef /*object*/)
+        // Limits for serializing a value into `RemoteObject.value`. The walk runs on the script thread while it's
+        // paused, so a value that doesn't fit is cut short rather than serialized in full.
+        const size_t c_MaxValueDepth = 32;
+        const int c_MaxValueNodes = 10000;
+        const size_t c_MaxValueBytes = 1024 * 1024;
+        const int c_MaxValueStringLength = 10000;
+
+        // Appended to the description of a value that was cut short, since the protocol has no field for it.
+        const char c_ValueTruncatedSuffix[] = " (truncated)";
+
+        // Previews of values are sent along with every console message, so they only look at the first few
+        // properties and the start of each string.
+        const int c_MaxValuePreviewProperties = 5;
+        const int c_MaxValuePreviewLength = 100;
+
+        String GetTypedArrayName(JsTypedArrayType arrayType, int* elementSize)
+        {
+            switch (arrayType)
+            {
+            case JsArrayTypeInt8:
+                *elementSize = 1;
+                return "Int8Array";
+            case JsArrayTypeUint8:
+                *elementSize = 1;
+                return "Uint8Array";
+            case JsArrayTypeUint8Clamped:
+                *elementSize = 1;
+                return "Uint8ClampedArray";
+            case JsArrayTypeInt16:
+                *elementSize = 2;
+                return "Int16Array";
+            case JsArrayTypeUint16:
+                *elementSize = 2;
+                return "Uint16Array";
+            case JsArrayTypeInt32:
+                *elementSize = 4;
+                return "Int32Array";
+            case JsArrayTypeUint32:
+                *elementSize = 4;
+                return "Uint32Array";
+            case JsArrayTypeFloat32:
+                *elementSize = 4;
+                return "Float32Array";
+            case JsArrayTypeFloat64:
+                *elementSize = 8;
+                return "Float64Array";
+            default:
+                *elementSize = 1;
+                return "TypedArray";
+            }
+        }
+
+        // Converts a value to its JSON equivalent, the way `JSON.stringify` would, but without calling into script.
+        // Only own data properties are read, so accessors are skipped, and proxies are left out since reading their
+        // properties would run their traps. Anything that is cyclic, a proxy or over a limit is replaced by null, and
+        // the result is then marked as truncated.
+        class ValueSerializer
+        {
+        public:
+            ValueSerializer()
+                : m_nodeCount(0)
+                , m_byteCount(0)
+                , m_isTruncated(false)
+            {
+            }
+
+            bool IsTruncated() const
+            {
+                return m_isTruncated;
+            }
+
+            // Returns null if the value has no JSON representation (undefined, functions and symbols).
+            std::unique_ptr<Value> Serialize(JsValueRef value)
+            {
+                try
+                {
+                    return SerializeValue(value);
+                }
+                catch (const JsErrorException&)
+                {
+                    // Don't leave an exception pending on the paused runtime.
+                    JsValueRef exception = JS_INVALID_REFERENCE;
+                    JsGetAndClearException(&exception);
+
+                    m_isTruncated = true;
+                    return Value::null();
+                }
+            }
+
+        private:
+            bool IsBudgetSpent()
+            {
+                if (m_nodeCount >= c_MaxValueNodes || m_byteCount >= c_MaxValueBytes)
+                {
+                    m_isTruncated = true;
+                    return true;
+                }
+
+                return false;
+            }
+
+            bool Reserve(size_t bytes)
+            {
+                if (m_nodeCount >= c_MaxValueNodes || m_byteCount + bytes > c_MaxValueBytes)
+                {
+                    m_isTruncated = true;
+                    return false;
+                }
+
+                ++m_nodeCount;
+                m_byteCount += bytes;
+                return true;
+            }
+
+            std::unique_ptr<Value> SerializeValue(JsValueRef value)
+            {
+                JsValueType type = JsUndefined;
+                IfJsErrorThrow(JsGetValueType(value, &type));
+
+                switch (type)
+                {
+                case JsUndefined:
+                case JsFunction:
+                case JsSymbol:
+                    return nullptr;
+                default:
+                    break;
+                }
+
+                // Each value costs at least a few bytes of JSON no matter its type.
+                if (!Reserve(sizeof(double)))
+                {
+                    return Value::null();
+                }
+
+                switch (type)
+                {
+                case JsNull:
+                    return Value::null();
+
+                case JsBoolean:
+                {
+                    bool boolValue = false;
+                    IfJsErrorThrow(JsBooleanToBool(value, &boolValue));
+                    return protocol::FundamentalValue::create(boolValue);
+                }
+
+                case JsNumber:
+                {
+                    double number = 0;
+                    IfJsErrorThrow(JsNumberToDouble(value, &number));
+                    if (!std::isfinite(number))
+                    {
+                        return Value::null();
+                    }
+
+                    if (number == std::trunc(number) &&
+                        number >= (std::numeric_limits<int>::min)() &&
+                        number <= (std::numeric_limits<int>::max)())
+                    {
+                        return protocol::FundamentalValue::create(static_cast<int>(number));
+                    }
+
+                    return protocol::FundamentalValue::create(number);
+                }
+
+                case JsString:
+                    return protocol::StringValue::create(ReadString(value));
+
+                default:
+                    break;
+                }
+
+                bool isProxy = false;
+                IfJsErrorThrow(JsGetProxyProperties(value, &isProxy, nullptr, nullptr));
+
+                if (isProxy ||
+                    std::find(m_ancestors.begin(), m_ancestors.end(), value) != m_ancestors.end() ||
+                    m_ancestors.size() >= c_MaxValueDepth)
+                {
+                    m_isTruncated = true;
+                    return Value::null();
+                }
+
+                m_ancestors.push_back(value);
+
+                std::unique_ptr<Value> result;
+                switch (type)
+                {
+                case JsArray:
+                    result = SerializeArray(value);
+                    break;
+                case JsTypedArray:
+                    result = SerializeTypedArray(value);
+                    break;
+                default:
+                    result = SerializeObject(value);
+                    break;
+                }
+
+                m_ancestors.pop_back();
+
+                return result;
+            }
+
+            std::unique_ptr<Value> SerializeArray(JsValueRef value)
+            {
+                auto list = protocol::ListValue::create();
+                int length = PropertyHelpers::GetPropertyInt(value, PropertyHelpers::Names::Length);
+
+                for (int index = 0; index < length && Reserve(1); ++index)
+                {
+                    std::string name = std::to_string(index);
+
+                    JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+                    IfJsErrorThrow(JsCreatePropertyId(name.data(), name.length(), &propertyId));
+
+                    // Holes and accessors are sent as null, rather than looked up on the prototype or run.
+                    std::unique_ptr<Value> serialized;
+                    JsValueRef element = JS_INVALID_REFERENCE;
+                    if (TryGetDataProperty(value, propertyId, false, &element))
+                    {
+                        serialized = SerializeValue(element);
+                    }
+
+                    list->pushValue(serialized != nullptr ? std::move(serialized) : Value::null());
+                }
+
+                return std::move(list);
+            }
+
+            // Typed arrays are objects keyed by index as far as `JSON.stringify` is concerned. They're walked by index
+            // like arrays, since listing the names of a large one would take as long as the walk the budget prevents.
+            // Any other own properties are left out.
+            std::unique_ptr<Value> SerializeTypedArray(JsValueRef value)
+            {
+                auto dictionary = DictionaryValue::create();
+
+                JsTypedArrayType arrayType = JsArrayTypeInt8;
+                unsigned int byteLength = 0;
+                IfJsErrorThrow(JsGetTypedArrayInfo(value, &arrayType, nullptr, nullptr, &byteLength));
+
+                int elementSize = 1;
+                GetTypedArrayName(arrayType, &elementSize);
+                int length = static_cast<int>(byteLength) / elementSize;
+
+                for (int index = 0; index < length; ++index)
+                {
+                    std::string name = std::to_string(index);
+                    if (!Reserve(name.length() + 4))
+                    {
+                        break;
+                    }
+
+                    JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+                    IfJsErrorThrow(JsCreatePropertyId(name.data(), name.length(), &propertyId));
+
+                    JsValueRef element = JS_INVALID_REFERENCE;
+                    if (!TryGetDataProperty(value, propertyId, true, &element))
+                    {
+                        continue;
+                    }
+
+                    auto serialized = SerializeValue(element);
+                    if (serialized != nullptr)
+                    {
+                        dictionary->setValue(String::fromUtf8(name.data(), name.length()), std::move(serialized));
+                    }
+                }
+
+                return std::move(dictionary);
+            }
+
+            std::unique_ptr<Value> SerializeObject(JsValueRef value)
+            {
+                auto dictionary = DictionaryValue::create();
+
+                // The engine can only list every name at once, so don't ask for them once nothing more would fit.
+                if (IsBudgetSpent())
+                {
+                    return std::move(dictionary);
+                }
+
+                JsValueRef names = JS_INVALID_REFERENCE;
+                IfJsErrorThrow(JsGetOwnPropertyNames(value, &names));
+                int length = PropertyHelpers::GetPropertyInt(names, PropertyHelpers::Names::Length);
+
+                std::vector<char> name;
+                for (int index = 0; index < length; ++index)
+                {
+                    JsValueRef nameValue = PropertyHelpers::GetIndexedProperty(names, index);
+
+                    size_t nameLength = 0;
+                    IfJsErrorThrow(JsCopyString(nameValue, nullptr, 0, &nameLength));
+                    if (!Reserve(nameLength + 4))
+                    {
+                        break;
+                    }
+
+                    name.resize(nameLength);
+                    IfJsErrorThrow(JsCopyString(nameValue, name.data(), name.size(), nullptr));
+
+                    JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+                    IfJsErrorThrow(JsCreatePropertyId(name.data(), name.size(), &propertyId));
+
+                    JsValueRef propertyValue = JS_INVALID_REFERENCE;
+                    if (!TryGetDataProperty(value, propertyId, true, &propertyValue))
+                    {
+                        continue;
+                    }
+
+                    auto serialized = SerializeValue(propertyValue);
+                    if (serialized != nullptr)
+                    {
+                        dictionary->setValue(String::fromUtf8(name.data(), name.size()), std::move(serialized));
+                    }
+                }
+
+                return std::move(dictionary);
+            }
+
+            // Only data properties are read so that no getters run while the script is paused. Object members that
+            // aren't enumerable are skipped, the same as `JSON.stringify` does, but array elements never are.
+            bool TryGetDataProperty(
+                JsValueRef object,
+                JsPropertyIdRef propertyId,
+                bool enumerableOnly,
+                JsValueRef* value)
+            {
+                JsValueRef descriptor = JS_INVALID_REFERENCE;
+                IfJsErrorThrow(JsGetOwnPropertyDescriptor(object, propertyId, &descriptor));
+
+                JsValueType descriptorType = JsUndefined;
+                IfJsErrorThrow(JsGetValueType(descriptor, &descriptorType));
+
+                if (descriptorType != JsObject)
+                {
+                    return false;
+                }
+
+                bool isEnumerable = false;
+                if (enumerableOnly &&
+                    (!PropertyHelpers::TryGetProperty(descriptor, PropertyHelpers::Names::Enumerable, &isEnumerable) ||
+                    !isEnumerable))
+                {
+                    return false;
+                }
+
+                return PropertyHelpers::TryGetProperty(descriptor, PropertyHelpers::Names::Value, value);
+            }
+
+            String ReadString(JsValueRef value)
+            {
+                int fullLength = 0;
+                IfJsErrorThrow(JsGetStringLength(value, &fullLength));
+
+                // Long strings are truncated to what's left of the budget.
+                size_t remaining = (c_MaxValueBytes - m_byteCount) / sizeof(UChar);
+                int length = (std::min)(fullLength, c_MaxValueStringLength);
+                length = static_cast<int>((std::min)(static_cast<size_t>(length), remaining));
+                m_byteCount += length * sizeof(UChar);
+
+                if (length < fullLength)
+                {
+                    m_isTruncated = true;
+                }
+
+                std::vector<uint16_t> buffer(length, 0);
+                IfJsErrorThrow(JsCopyStringUtf16(value, 0, length, buffer.data(), nullptr));
+
+                return String(buffer.data(), buffer.size());
+            }
+
+            std::vector<JsValueRef> m_ancestors;
+            int m_nodeCount;
+            size_t m_byteCount;
+            bool m_isTruncated;
+        };
+
+        bool IsPrimitiveOfType(JsValueRef value, const String& type)
+        {
+            JsValueType valueType = JsUndefined;
+            if (JsGetValueType(value, &valueType) != JsNoError)
+            {
+                return false;
+            }
+
+            switch (valueType)
+            {
+            case JsBoolean:
+                return type == "boolean";
+            case JsNumber:
+                return type == "number";
+            case JsString:
+                return type == "string";
+            default:
+                return false;
+            }
+        }
+
+        String ReadStringPrefix(JsValueRef value, int maxLength)
+        {
+            int length = 0;
+            IfJsErrorThrow(JsGetStringLength(value, &length));
+            length = (std::min)(length, maxLength);
+
+            std::vector<uint16_t> buffer(length, 0);
+            IfJsErrorThrow(JsCopyStringUtf16(value, 0, length, buffer.data(), nullptr));
+
+            return String(buffer.data(), buffer.size());
+        }
+
+        // Reads a string data property from the object or its prototypes. Getters aren't run, so an accessor ends
+        // the lookup the same as a missing property.
+        bool TryGetDataPropertyString(JsValueRef object, const char* name, String* value)
+        {
+            JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+            IfJsErrorThrow(JsCreatePropertyId(name, std::strlen(name), &propertyId));
+
+            for (size_t depth = 0; depth < c_MaxValueDepth; ++depth)
+            {
+                JsValueRef descriptor = JS_INVALID_REFERENCE;
+                IfJsErrorThrow(JsGetOwnPropertyDescriptor(object, propertyId, &descriptor));
+
+                JsValueType descriptorType = JsUndefined;
+                IfJsErrorThrow(JsGetValueType(descriptor, &descriptorType));
+
+                if (descriptorType == JsObject)
+                {
+                    JsValueRef propertyValue = JS_INVALID_REFERENCE;
+                    JsValueType propertyType = JsUndefined;
+                    if (!PropertyHelpers::TryGetProperty(descriptor, PropertyHelpers::Names::Value, &propertyValue) ||
+                        JsGetValueType(propertyValue, &propertyType) != JsNoError ||
+                        propertyType != JsString)
+                    {
+                        return false;
+                    }
+
+                    *value = ReadStringPrefix(propertyValue, c_MaxValueStringLength);
+                    return true;
+                }
+
+                IfJsErrorThrow(JsGetPrototype(object, &object));
+
+                JsValueType objectType = JsUndefined;
+                IfJsErrorThrow(JsGetValueType(object, &objectType));
+
+                if (objectType == JsNull)
+                {
+                    break;
+                }
+            }
+
+            return false;
+        }
+
+        // Describes objects from what the engine knows about them, rather than by converting them to a string, which
+        // would run their toString.
+        String DescribeObject(JsValueRef value, JsValueType valueType)
+        {
+            switch (valueType)
+            {
+            case JsTypedArray:
+            {
+                JsTypedArrayType arrayType = JsArrayTypeInt8;
+                unsigned int byteLength = 0;
+                IfJsErrorThrow(JsGetTypedArrayInfo(value, &arrayType, nullptr, nullptr, &byteLength));
+
+                int elementSize = 1;
+                String name = GetTypedArrayName(arrayType, &elementSize);
+                return name + "(" + String::fromInteger(static_cast<int>(byteLength) / elementSize) + ")";
+            }
+            case JsArrayBuffer:
+            {
+                ChakraBytePtr buffer = nullptr;
+                unsigned int byteLength = 0;
+                IfJsErrorThrow(JsGetArrayBufferStorage(value, &buffer, &byteLength));
+                return "ArrayBuffer(" + String::fromInteger(static_cast<int>(byteLength)) + ")";
+            }
+            case JsDataView:
+            {
+                ChakraBytePtr buffer = nullptr;
+                unsigned int byteLength = 0;
+                IfJsErrorThrow(JsGetDataViewStorage(value, &buffer, &byteLength));
+                return "DataView(" + String::fromInteger(static_cast<int>(byteLength)) + ")";
+            }
+            case JsFunction:
+            {
+                String name;
+                TryGetDataPropertyString(value, PropertyHelpers::Names::Name, &name);
+                return "function " + name + "()";
+            }
+            case JsError:
+            {
+                String name;
+                if (!TryGetDataPropertyString(value, PropertyHelpers::Names::Name, &name) || name.empty())
+                {
+                    name = PropertyHelpers::Names::Error;
+                }
+
+                String message;
+                if (TryGetDataPropertyString(value, PropertyHelpers::Names::Message, &message) && !message.empty())
+                {
+                    return name + ": " + message;
+                }
+
+                return name;
+            }
+            default:
+                return "Object";
+            }
+        }
+
+        // Describes a property without calling into script. Nested objects are only named, not walked.
+        std::unique_ptr<PropertyPreview> WrapPropertyPreview(const String& name, JsValueRef value, int maxLength)
+        {
+            JsValueType valueType = JsUndefined;
+            IfJsErrorThrow(JsGetValueType(value, &valueType));
+
+            String type = "object";
+            String subtype;
+            String description;
+
+            switch (valueType)
+            {
+            case JsUndefined:
+                type = "undefined";
+                description = "undefined";
+                break;
+            case JsNull:
+                subtype = "null";
+                description = "null";
+                break;
+            case JsNumber:
+            case JsBoolean:
+                type = valueType == JsNumber ? "number" : "boolean";
+                description = PropertyHelpers::ValueToString(value);
+                break;
+            case JsString:
+                type = "string";
+                description = ReadStringPrefix(value, maxLength);
+                break;
+            case JsSymbol:
+                type = "symbol";
+                description = "Symbol()";
+                break;
+            case JsFunction:
+                type = "function";
+                break;
+            case JsArray:
+                subtype = "array";
+                description = "Array(" +
+                    String::fromInteger(PropertyHelpers::GetPropertyInt(value, PropertyHelpers::Names::Length)) + ")";
+                break;
+            case JsTypedArray:
+                subtype = "typedarray";
+                description = "Object";
+                break;
+            case JsError:
+                subtype = "error";
+                description = "Error";
+                break;
+            default:
+                description = "Object";
+                break;
+            }
+
+            auto preview = PropertyPreview::create()
+                .setName(name)
+                .setType(type)
+                .build();
+
+            if (!description.empty())
+            {
+                preview->setValue(description);
+            }
+
+            if (!subtype.empty())
+            {
+                preview->setSubtype(subtype);
+            }
+
+            return preview;
+        }
+
+        // Returns true if the value had to be cut short.
+        bool SetValue(RemoteObject* remoteObject, JsValueRef value)
         {
-            // TODO: traverse object graph and build protocol value.
-            return Value::null();
+            JsValueType valueType = JsUndefined;
+            IfJsErrorThrow(JsGetValueType(value, &valueType));
+
+            if (valueType == JsNumber)
+            {
+                // JSON has no representation for these numbers, so they are sent as strings instead.
+                double number = 0;
+                IfJsErrorThrow(JsNumberToDouble(value, &number));
+
+                if (std::isnan(number))
+                {
+                    remoteObject->setUnserializableValue(protocol::Runtime::UnserializableValueEnum::NaN);
+                    return false;
+                }
+                else if (std::isinf(number))
+                {
+                    remoteObject->setUnserializableValue(number > 0
+                        ? protocol::Runtime::UnserializableValueEnum::Infinity
+                        : protocol::Runtime::UnserializableValueEnum::NegativeInfinity);
+                    return false;
+                }
+                else if (number == 0 && std::signbit(number))
+                {
+                    remoteObject->setUnserializableValue(protocol::Runtime::UnserializableValueEnum::Negative0);
+                    return false;
+                }
+            }
+
+            ValueSerializer serializer;
+            auto serialized = serializer.Serialize(value);
+            if (serialized != nullptr)
+            {
+                remoteObject->setValue(std::move(serialized));
+            }
+
+            return serializer.IsTruncated();
         }
 
         std::unique_ptr<RemoteObject> CreateObject(JsValueRef object)
@@ -44,6 +673,18 @@ namespace JsDebug
         return "{\"handle\":" + String::fromInteger(handle) + "}";
     }
 
+    String ProtocolHelpers::GetObjectId(int handle, int from, int count)
+    {
+        return "{\"handle\":" + String::fromInteger(handle) +
+            ",\"from\":" + String::fromInteger(from) +
+            ",\"count\":" + String::fromInteger(count) + "}";
+    }
+
+    String ProtocolHelpers::GetRuntimeObjectId(int id)
+    {
+        return "{\"id\":" + String::fromInteger(id) + "}";
+    }
+
     std::unique_ptr<DictionaryValue> ProtocolHelpers::ParseObjectId(const String& objectId)
     {
         auto parsedValue = StringUtil::parseJSON(objectId);
@@ -56,6 +697,11 @@ namespace JsDebug
     }
 
     std::unique_ptr<RemoteObject> ProtocolHelpers::WrapObject(JsValueRef object)
+    {
+        return WrapObject(object, false);
+    }
+
+    std::unique_ptr<RemoteObject> ProtocolHelpers::WrapObject(JsValueRef object, bool returnByValue)
     {
         auto remoteObject = CreateObject(object);
 
@@ -67,12 +713,14 @@ namespace JsDebug
 
         JsValueRef value = JS_INVALID_REFERENCE;
         bool hasValue = PropertyHelpers::TryGetProperty(object, PropertyHelpers::Names::Value, &value);
-        // TODO: Once `ToProtocolValue` is implemented uncomment the following code. VS Code prefers `value` in most
-        //       cases and prevents viewing the values of variables.
-        ////if (hasValue)
-        ////{
-        ////    remoteObject->setValue(ToProtocolValue(value));
-        ////}
+
+        // Primitives always carry their value since VS Code prefers `value` over the description when showing them.
+        // Objects only carry one when asked for, as it means walking the whole object graph.
+        bool isTruncated = false;
+        if (hasValue && (returnByValue || IsPrimitiveOfType(value, remoteObject->getType())))
+        {
+            isTruncated = SetValue(remoteObject.get(), value);
+        }
 
         String display;
         bool hasDisplay = PropertyHelpers::TryGetProperty(object, PropertyHelpers::Names::Display, &display);
@@ -90,7 +738,7 @@ namespace JsDebug
             }
         }
 
-        remoteObject->setDescription(display);
+        remoteObject->setDescription(isTruncated ? display + c_ValueTruncatedSuffix : display);
 
         int handle = 0;
         if (PropertyHelpers::TryGetProperty(object, PropertyHelpers::Names::Handle, &handle))
@@ -101,6 +749,362 @@ namespace JsDebug
         return remoteObject;
     }
 
+    std::unique_ptr<RemoteObject> ProtocolHelpers::WrapValue(JsValueRef value, bool returnByValue)
+    {
+        JsValueType valueType = JsUndefined;
+        IfJsErrorThrow(JsGetValueType(value, &valueType));
+
+        String type = "object";
+        String subtype;
+
+        switch (valueType)
+        {
+        case JsUndefined:
+            type = "undefined";
+            break;
+        case JsNull:
+            subtype = "null";
+            break;
+        case JsNumber:
+            type = "number";
+            break;
+        case JsString:
+            type = "string";
+            break;
+        case JsBoolean:
+            type = "boolean";
+            break;
+        case JsFunction:
+            type = "function";
+            break;
+        case JsSymbol:
+            type = "symbol";
+            break;
+        case JsError:
+            subtype = "error";
+            break;
+        case JsArray:
+            subtype = "array";
+            break;
+        case JsTypedArray:
+            subtype = "typedarray";
+            break;
+        case JsArrayBuffer:
+            subtype = "arraybuffer";
+            break;
+        case JsDataView:
+            subtype = "dataview";
+            break;
+        default:
+            break;
+        }
+
+        auto remoteObject = RemoteObject::create()
+            .setType(type)
+            .build();
+
+        if (!subtype.empty())
+        {
+            remoteObject->setSubtype(subtype);
+        }
+
+        // Objects are described without calling into script, as their toString could do anything.
+        String description;
+        if (valueType == JsObject ||
+            valueType == JsTypedArray ||
+            valueType == JsArrayBuffer ||
+            valueType == JsDataView ||
+            valueType == JsFunction ||
+            valueType == JsError)
+        {
+            try
+            {
+                description = DescribeObject(value, valueType);
+            }
+            catch (const JsErrorException&)
+            {
+                // A proxy in the prototype chain may have thrown.
+                JsValueRef exception = JS_INVALID_REFERENCE;
+                JsGetAndClearException(&exception);
+
+                description = valueType == JsFunction ? "function" : "Object";
+            }
+        }
+        else if (valueType == JsArray)
+        {
+            description = "Array(" +
+                String::fromInteger(PropertyHelpers::GetPropertyInt(value, PropertyHelpers::Names::Length)) + ")";
+        }
+        else if (valueType == JsSymbol)
+        {
+            description = "Symbol()";
+        }
+        else
+        {
+            try
+            {
+                description = PropertyHelpers::ValueToString(value);
+            }
+            catch (const JsErrorException&)
+            {
+                JsValueRef exception = JS_INVALID_REFERENCE;
+                JsGetAndClearException(&exception);
+
+                description = type;
+            }
+        }
+
+        if (returnByValue ||
+            valueType == JsNull || valueType == JsNumber || valueType == JsString || valueType == JsBoolean)
+        {
+            if (SetValue(remoteObject.get(), value))
+            {
+                description = description + c_ValueTruncatedSuffix;
+            }
+        }
+
+        remoteObject->setDescription(description);
+
+        return remoteObject;
+    }
+
+    std::unique_ptr<RemoteObject> ProtocolHelpers::WrapValueSummary(JsValueRef value, int maxStringLength)
+    {
+        // Described the same way as a property in a preview, so nothing here calls into script.
+        auto summary = WrapPropertyPreview(String(), value, maxStringLength);
+
+        auto remoteObject = RemoteObject::create()
+            .setType(summary->getType())
+            .build();
+
+        if (summary->hasSubtype())
+        {
+            remoteObject->setSubtype(summary->getSubtype(String()));
+        }
+
+        JsValueType valueType = JsUndefined;
+        IfJsErrorThrow(JsGetValueType(value, &valueType));
+
+        if (valueType == JsString)
+        {
+            remoteObject->setValue(protocol::StringValue::create(summary->getValue(String())));
+        }
+        else if (valueType == JsNull || valueType == JsNumber || valueType == JsBoolean)
+        {
+            SetValue(remoteObject.get(), value);
+        }
+
+        if (summary->hasValue())
+        {
+            remoteObject->setDescription(summary->getValue(String()));
+        }
+
+        return remoteObject;
+    }
+
+    std::unique_ptr<ObjectPreview> ProtocolHelpers::GetValuePreview(
+        JsValueRef value,
+        RemoteObject& remoteObject,
+        JsValueRef getPropertyNames)
+    {
+        if (remoteObject.getType() != "object" || remoteObject.getSubtype(String()) == "null")
+        {
+            return nullptr;
+        }
+
+        JsValueType valueType = JsUndefined;
+        IfJsErrorThrow(JsGetValueType(value, &valueType));
+
+        auto properties = protocol::Array<PropertyPreview>::create();
+        bool overflow = false;
+
+        // Reading anything from a proxy would run its traps, so it's previewed without properties.
+        bool isProxy = false;
+        IfJsErrorThrow(JsGetProxyProperties(value, &isProxy, nullptr, nullptr));
+
+        // Adds the value of a data property, or a placeholder for an accessor, as getters aren't run for a preview.
+        auto addDescriptor = [&](const String& name, JsValueRef descriptor)
+        {
+            JsValueRef propertyValue = JS_INVALID_REFERENCE;
+            if (PropertyHelpers::TryGetProperty(descriptor, PropertyHelpers::Names::Value, &propertyValue))
+            {
+                properties->addItem(WrapPropertyPreview(name, propertyValue, c_MaxValuePreviewLength));
+            }
+            else
+            {
+                properties->addItem(PropertyPreview::create()
+                    .setName(name)
+                    .setType(PropertyPreview::TypeEnum::Accessor)
+                    .build());
+            }
+        };
+
+        try
+        {
+            if (valueType == JsArray || valueType == JsTypedArray)
+            {
+                // Elements are read by index, so that the names of every element aren't listed first. A typed array's
+                // length is a getter on its prototype, so it's worked out from the size of its buffer instead.
+                int length = 0;
+                if (valueType == JsTypedArray)
+                {
+                    JsTypedArrayType arrayType = JsArrayTypeInt8;
+                    unsigned int byteLength = 0;
+                    IfJsErrorThrow(JsGetTypedArrayInfo(value, &arrayType, nullptr, nullptr, &byteLength));
+
+                    int elementSize = 1;
+                    GetTypedArrayName(arrayType, &elementSize);
+                    length = static_cast<int>(byteLength) / elementSize;
+                }
+                else
+                {
+                    length = PropertyHelpers::GetPropertyInt(value, PropertyHelpers::Names::Length);
+                }
+
+                int count = (std::min)(length, c_MaxValuePreviewProperties);
+
+                for (int index = 0; index < count; ++index)
+                {
+                    std::string key = std::to_string(index);
+                    String name = String::fromInteger(index);
+
+                    JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+                    IfJsErrorThrow(JsCreatePropertyId(key.data(), key.length(), &propertyId));
+
+                    // Only own elements are read, so a hole is shown as undefined rather than looked up on the
+                    // prototype.
+                    JsValueRef descriptor = JS_INVALID_REFERENCE;
+                    IfJsErrorThrow(JsGetOwnPropertyDescriptor(value, propertyId, &descriptor));
+
+                    JsValueType descriptorType = JsUndefined;
+                    IfJsErrorThrow(JsGetValueType(descriptor, &descriptorType));
+
+                    if (descriptorType == JsObject)
+                    {
+                        addDescriptor(name, descriptor);
+                    }
+                    else
+                    {
+                        properties->addItem(WrapPropertyPreview(name, descriptor, c_MaxValuePreviewLength));
+                    }
+                }
+
+                overflow = length > count;
+            }
+            else if (!isProxy)
+            {
+                // Adds the property if it's an enumerable own property, or returns false once the preview is full.
+                auto addProperty = [&](JsValueRef nameValue) -> bool
+                {
+                    String name;
+                    JsValueRef descriptor = PropertyHelpers::GetOwnPropertyDescriptor(value, nameValue, &name);
+
+                    JsValueType descriptorType = JsUndefined;
+                    IfJsErrorThrow(JsGetValueType(descriptor, &descriptorType));
+
+                    if (descriptorType != JsObject ||
+                        !PropertyHelpers::GetPropertyBool(descriptor, PropertyHelpers::Names::Enumerable))
+                    {
+                        return true;
+                    }
+
+                    if (static_cast<int>(properties->length()) == c_MaxValuePreviewProperties)
+                    {
+                        overflow = true;
+                        return false;
+                    }
+
+                    addDescriptor(name, descriptor);
+                    return true;
+                };
+
+                if (getPropertyNames != JS_INVALID_REFERENCE)
+                {
+                    // Only as many names as the preview can use are read, one more than fits so that overflow can be
+                    // told apart. They come back as a single string of length-prefixed names.
+                    JsValueRef arguments[3] = { JS_INVALID_REFERENCE, value, JS_INVALID_REFERENCE };
+                    IfJsErrorThrow(JsGetUndefinedValue(&arguments[0]));
+                    IfJsErrorThrow(JsIntToNumber(c_MaxValuePreviewProperties + 1, &arguments[2]));
+
+                    JsValueRef names = JS_INVALID_REFERENCE;
+                    IfJsErrorThrow(JsCallFunction(getPropertyNames, arguments, 3, &names));
+
+                    int length = 0;
+                    IfJsErrorThrow(JsGetStringLength(names, &length));
+
+                    std::vector<uint16_t> buffer(length, 0);
+                    IfJsErrorThrow(JsCopyStringUtf16(names, 0, length, buffer.data(), nullptr));
+
+                    size_t position = 0;
+                    while (position < buffer.size())
+                    {
+                        size_t nameLength = 0;
+                        while (position < buffer.size() && buffer[position] != ':')
+                        {
+                            nameLength = nameLength * 10 + (buffer[position++] - '0');
+                        }
+
+                        position++;
+                        if (position + nameLength > buffer.size())
+                        {
+                            break;
+                        }
+
+                        JsValueRef nameValue = JS_INVALID_REFERENCE;
+                        IfJsErrorThrow(JsCreateStringUtf16(buffer.data() + position, nameLength, &nameValue));
+                        position += nameLength;
+
+                        if (!addProperty(nameValue))
+                        {
+                            break;
+                        }
+                    }
+                }
+                else
+                {
+                    JsValueRef names = JS_INVALID_REFERENCE;
+                    IfJsErrorThrow(JsGetOwnPropertyNames(value, &names));
+                    int length = PropertyHelpers::GetPropertyInt(names, PropertyHelpers::Names::Length);
+
+                    for (int index = 0; index < length; ++index)
+                    {
+                        if (!addProperty(PropertyHelpers::GetIndexedProperty(names, index)))
+                        {
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+        catch (const JsErrorException&)
+        {
+            // A proxy further up the prototype chain may have thrown while the names were listed, in which case the
+            // preview only has what was read before that.
+            JsValueRef exception = JS_INVALID_REFERENCE;
+            JsGetAndClearException(&exception);
+
+            overflow = true;
+        }
+
+        auto preview = ObjectPreview::create()
+            .setType(remoteObject.getType())
+            .setOverflow(overflow)
+            .setProperties(std::move(properties))
+            .build();
+
+        if (remoteObject.hasSubtype())
+        {
+            preview->setSubtype(remoteObject.getSubtype(String()));
+        }
+
+        if (remoteObject.hasDescription())
+        {
+            preview->setDescription(remoteObject.getDescription(String()));
+        }
+
+        return preview;
+    }
+
     std::unique_ptr<RemoteObject> ProtocolHelpers::WrapException(JsValueRef exception)
     {
         std::unique_ptr<RemoteObject> wrapped = WrapObject(exception);
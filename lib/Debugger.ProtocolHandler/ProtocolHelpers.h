@@ -13,8 +13,22 @@ namespace JsDebug
     namespace ProtocolHelpers
     {
         protocol::String GetObjectId(int handle);
+        protocol::String GetObjectId(int handle, int from, int count);
+        protocol::String GetRuntimeObjectId(int id);
         std::unique_ptr<protocol::DictionaryValue> ParseObjectId(const protocol::String& objectId);
         std::unique_ptr<protocol::Runtime::RemoteObject> WrapObject(JsValueRef object);
+        std::unique_ptr<protocol::Runtime::RemoteObject> WrapObject(JsValueRef object, bool returnByValue);
+        std::unique_ptr<protocol::Runtime::RemoteObject> WrapValue(JsValueRef value, bool returnByValue);
+        std::unique_ptr<protocol::Runtime::RemoteObject> WrapValueSummary(JsValueRef value, int maxStringLength);
+
+        // Objects list their properties through getPropertyNames if it's given, which is called with the object and
+        // the number of names wanted and returns them length-prefixed in a string. Otherwise all of the object's own
+        // property names are listed first.
+        std::unique_ptr<protocol::Runtime::ObjectPreview> GetValuePreview(
+            JsValueRef value,
+            protocol::Runtime::RemoteObject& remoteObject,
+            JsValueRef getPropertyNames);
+
         std::unique_ptr<protocol::Runtime::RemoteObject> WrapException(JsValueRef exception);
         std::unique_ptr<protocol::Runtime::ExceptionDetails> WrapExceptionDetails(JsValueRef exception);
         std::unique_ptr<protocol::Runtime::PropertyDescriptor> WrapProperty(JsValueRef property);
@@ -8,38 +8,200 @@
 #include "ProtocolHandler.h"
 #include "ProtocolHelpers.h"
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
 #include <StringUtil.h>
+#include <vector>
 
 namespace JsDebug
 {
     using protocol::Array;
     using protocol::DictionaryValue;
     using protocol::FrontendChannel;
+    using protocol::ListValue;
     using protocol::Maybe;
     using protocol::Response;
     using protocol::Runtime::CallArgument;
     using protocol::Runtime::ExceptionDetails;
     using protocol::Runtime::InternalPropertyDescriptor;
     using protocol::Runtime::PropertyDescriptor;
+    using protocol::Runtime::RemoteObject;
     using protocol::String;
     using protocol::StringUtil;
     using protocol::Value;
 
     namespace
     {
+        const char c_ConsoleObjectGroup[] = "console";
+        const char c_DefaultExceptionText[] = "Uncaught";
+        const char c_ErrorCannotCallWhilePaused[] = "Functions can't be called on objects while paused";
+        const char c_ErrorDeclarationNotFunction[] = "Given expression does not evaluate to a function";
+        const char c_ErrorInvalidContextId[] = "Cannot find context with specified id";
         const char c_ErrorInvalidObjectId[] = "Invalid object ID";
+        const char c_ErrorInvalidScriptId[] = "No script with given id";
+        const char c_ErrorNoHostContext[] = "No execution context has been set by the host";
         const char c_ErrorNotEnabled[] = "Runtime is not enabled";
         const char c_ErrorNotImplemented[] = "Not implemented";
+
+        // Enough for the watch expressions and recent console input of a typical session.
+        const size_t c_MaxCachedScripts = 64;
+
+        // Values handed out while running are kept alive until the frontend releases them, up to this many.
+        const size_t c_MaxRuntimeObjects = 1000;
+
+        // Objects with more properties than this are only listed in part.
+        const int c_MaxRuntimeObjectProperties = 1000;
+
+        // Lists the first few names a for-in loop visits, so that previews don't list every property of large objects.
+        // The names are joined into one length-prefixed string, which doesn't rely on any built-in that script could
+        // have replaced.
+        const char c_GetPropertyNamesSource[] =
+            "(function (object, limit) {\n"
+            "    var names = '';\n"
+            "    var count = 0;\n"
+            "    for (var name in object) {\n"
+            "        names += name.length + ':' + name;\n"
+            "        if (++count === limit) {\n"
+            "            break;\n"
+            "        }\n"
+            "    }\n"
+            "    return names;\n"
+            "})";
+
+        void GetPropertyDescriptors(
+            const DebuggerObject& obj,
+            bool generatePreview,
+            std::unique_ptr<Array<PropertyDescriptor>>* out_result,
+            Maybe<Array<InternalPropertyDescriptor>>* out_internalProperties)
+        {
+            std::unique_ptr<Array<InternalPropertyDescriptor>> internalProperties;
+            obj.GetPropertyDescriptors(generatePreview, out_result, &internalProperties);
+
+            *out_internalProperties = std::move(internalProperties);
+        }
+
+        void AddToObjectGroup(Debugger* debugger, const String& group, RemoteObject* object)
+        {
+            int handle = 0;
+            if (object != nullptr &&
+                object->hasObjectId() &&
+                ProtocolHelpers::ParseObjectId(object->getObjectId(String()))->getInteger(
+                    PropertyHelpers::Names::Handle,
+                    &handle))
+            {
+                debugger->AddToObjectGroup(group, handle);
+            }
+        }
+
+        // Puts the objects that the properties refer to into the group of the object they were read from, so that
+        // releasing the group also releases everything the frontend expanded from it.
+        void AddToObjectGroup(
+            Debugger* debugger,
+            const String& group,
+            Array<PropertyDescriptor>* properties,
+            Maybe<Array<InternalPropertyDescriptor>>* internalProperties)
+        {
+            for (size_t i = 0; i < properties->length(); ++i)
+            {
+                PropertyDescriptor* property = properties->get(i);
+                AddToObjectGroup(debugger, group, property->getValue(nullptr));
+                AddToObjectGroup(debugger, group, property->getGet(nullptr));
+                AddToObjectGroup(debugger, group, property->getSet(nullptr));
+            }
+
+            if (internalProperties != nullptr && internalProperties->isJust())
+            {
+                Array<InternalPropertyDescriptor>* internal = internalProperties->fromJust();
+                for (size_t i = 0; i < internal->length(); ++i)
+                {
+                    AddToObjectGroup(debugger, group, internal->get(i)->getValue(nullptr));
+                }
+            }
+        }
+
+        // Creates an argument straight from the parsed message, rather than serializing it again for the engine to
+        // parse.
+        JsValueRef ToJsValue(Value* value)
+        {
+            JsValueRef result = JS_INVALID_REFERENCE;
+
+            switch (value->type())
+            {
+            case Value::TypeBoolean:
+            {
+                bool boolValue = false;
+                value->asBoolean(&boolValue);
+                IfJsErrorThrow(JsBoolToBoolean(boolValue, &result));
+                break;
+            }
+            case Value::TypeInteger:
+            {
+                int intValue = 0;
+                value->asInteger(&intValue);
+                IfJsErrorThrow(JsIntToNumber(intValue, &result));
+                break;
+            }
+            case Value::TypeDouble:
+            {
+                double doubleValue = 0;
+                value->asDouble(&doubleValue);
+                IfJsErrorThrow(JsDoubleToNumber(doubleValue, &result));
+                break;
+            }
+            case Value::TypeString:
+            {
+                String stringValue;
+                value->asString(&stringValue);
+                IfJsErrorThrow(JsCreateStringUtf16(stringValue.characters16(), stringValue.length(), &result));
+                break;
+            }
+            case Value::TypeObject:
+            {
+                DictionaryValue* dictionary = DictionaryValue::cast(value);
+                IfJsErrorThrow(JsCreateObject(&result));
+
+                for (size_t i = 0; i < dictionary->size(); ++i)
+                {
+                    auto entry = dictionary->at(i);
+
+                    JsValueRef name = JS_INVALID_REFERENCE;
+                    IfJsErrorThrow(JsCreateStringUtf16(entry.first.characters16(), entry.first.length(), &name));
+                    IfJsErrorThrow(JsSetIndexedProperty(result, name, ToJsValue(entry.second)));
+                }
+                break;
+            }
+            case Value::TypeArray:
+            {
+                ListValue* list = ListValue::cast(value);
+                IfJsErrorThrow(JsCreateArray(static_cast<unsigned int>(list->size()), &result));
+
+                for (size_t i = 0; i < list->size(); ++i)
+                {
+                    JsValueRef index = JS_INVALID_REFERENCE;
+                    IfJsErrorThrow(JsIntToNumber(static_cast<int>(i), &index));
+                    IfJsErrorThrow(JsSetIndexedProperty(result, index, ToJsValue(list->at(i))));
+                }
+                break;
+            }
+            default:
+                IfJsErrorThrow(JsGetNullValue(&result));
+                break;
+            }
+
+            return result;
+        }
     }
 
     RuntimeImpl::RuntimeImpl(ProtocolHandler* handler, FrontendChannel* frontendChannel, Debugger* debugger)
-        : m_timestamp(1)
-        , m_handler(handler)
+        : m_handler(handler)
         , m_frontend(frontendChannel)
         , m_debugger(debugger)
         , m_contextId(1)
         , m_isEnabled(false)
+        , m_lastExceptionId(0)
+        , m_scriptCache(c_MaxCachedScripts)
+        , m_runtimeObjects(c_MaxRuntimeObjects)
     {
     }
 
@@ -48,18 +210,71 @@ namespace JsDebug
     }
 
     void RuntimeImpl::evaluate(
-        const String& /*in_expression*/,
-        Maybe<String> /*in_objectGroup*/,
+        const String& in_expression,
+        Maybe<String> in_objectGroup,
         Maybe<bool> /*in_includeCommandLineAPI*/,
         Maybe<bool> /*in_silent*/,
-        Maybe<int> /*in_contextId*/,
-        Maybe<bool> /*in_returnByValue*/,
-        Maybe<bool> /*in_generatePreview*/,
+        Maybe<int> in_contextId,
+        Maybe<bool> in_returnByValue,
+        Maybe<bool> in_generatePreview,
         Maybe<bool> /*in_userGesture*/,
         Maybe<bool> /*in_awaitPromise*/,
         std::unique_ptr<EvaluateCallback> callback)
     {
-        callback->sendFailure(Response::Error(c_ErrorNotImplemented));
+        if (!IsValidContextId(in_contextId))
+        {
+            callback->sendFailure(Response::Error(c_ErrorInvalidContextId));
+            return;
+        }
+
+        bool returnByValue = in_returnByValue.fromMaybe(false);
+        std::unique_ptr<RemoteObject> result;
+        Maybe<ExceptionDetails> exceptionDetails;
+
+        try
+        {
+            if (m_debugger->IsPaused())
+            {
+                result = EvaluateOnTopFrame(
+                    in_expression,
+                    in_objectGroup,
+                    returnByValue,
+                    in_generatePreview.fromMaybe(false),
+                    &exceptionDetails);
+            }
+            else
+            {
+                DebuggerContext::Scope hostScope(GetHostContext());
+
+                String scriptId;
+                JsValueRef function = JS_INVALID_REFERENCE;
+                JsErrorCode err = m_scriptCache.Compile(in_expression, String(), &scriptId, &function);
+
+                if (err == JsErrorScriptCompile)
+                {
+                    JsValueRef exception = JS_INVALID_REFERENCE;
+                    exceptionDetails = GetExceptionDetails(&exception);
+                    result = ProtocolHelpers::WrapValue(exception, false);
+                }
+                else
+                {
+                    IfJsErrorThrow(err);
+                    result = CallCompiledScript(
+                        function,
+                        in_objectGroup.fromMaybe(String()),
+                        returnByValue,
+                        in_generatePreview.fromMaybe(false),
+                        &exceptionDetails);
+                }
+            }
+        }
+        catch (const JsErrorException& e)
+        {
+            callback->sendFailure(Response::Error(e.what()));
+            return;
+        }
+
+        callback->sendSuccess(std::move(result), std::move(exceptionDetails));
     }
 
     void RuntimeImpl::awaitPromise(
@@ -72,24 +287,104 @@ namespace JsDebug
     }
 
     void RuntimeImpl::callFunctionOn(
-        const String& /*in_objectId*/,
-        const String& /*in_functionDeclaration*/,
-        Maybe<Array<CallArgument>> /*in_arguments*/,
+        const String& in_objectId,
+        const String& in_functionDeclaration,
+        Maybe<Array<CallArgument>> in_arguments,
         Maybe<bool> /*in_silent*/,
-        Maybe<bool> /*in_returnByValue*/,
-        Maybe<bool> /*in_generatePreview*/,
+        Maybe<bool> in_returnByValue,
+        Maybe<bool> in_generatePreview,
         Maybe<bool> /*in_userGesture*/,
         Maybe<bool> /*in_awaitPromise*/,
         std::unique_ptr<CallFunctionOnCallback> callback)
     {
-        callback->sendFailure(Response::Error(c_ErrorNotImplemented));
+        // Objects inspected while paused are only known by their engine handle, which can't be turned back into a
+        // value, and script can't be run directly until execution resumes.
+        if (m_debugger->IsPaused())
+        {
+            callback->sendFailure(Response::Error(c_ErrorCannotCallWhilePaused));
+            return;
+        }
+
+        auto parsedId = ProtocolHelpers::ParseObjectId(in_objectId);
+
+        int id = 0;
+        JsValueRef object = JS_INVALID_REFERENCE;
+        String objectGroup;
+        if (!parsedId->getInteger(PropertyHelpers::Names::Id, &id) ||
+            !m_runtimeObjects.TryGet(id, &object, &objectGroup))
+        {
+            callback->sendFailure(Response::Error(c_ErrorInvalidObjectId));
+            return;
+        }
+
+        std::unique_ptr<RemoteObject> result;
+        Maybe<ExceptionDetails> exceptionDetails;
+
+        try
+        {
+            DebuggerContext::Scope hostScope(GetHostContext());
+
+            std::vector<JsValueRef> arguments { object };
+            if (in_arguments.isJust())
+            {
+                Array<CallArgument>* callArguments = in_arguments.fromJust();
+                for (size_t i = 0; i < callArguments->length(); ++i)
+                {
+                    JsValueRef argument = JS_INVALID_REFERENCE;
+                    if (!TryGetArgument(callArguments->get(i), &argument))
+                    {
+                        callback->sendFailure(Response::Error(c_ErrorInvalidObjectId));
+                        return;
+                    }
+
+                    arguments.push_back(argument);
+                }
+            }
+
+            JsValueRef function = JS_INVALID_REFERENCE;
+            JsErrorCode err = CreateFunction(in_functionDeclaration, &function);
+
+            if (err == JsErrorScriptCompile || err == JsErrorScriptException)
+            {
+                JsValueRef exception = JS_INVALID_REFERENCE;
+                exceptionDetails = GetExceptionDetails(&exception);
+                result = ProtocolHelpers::WrapValue(exception, false);
+            }
+            else
+            {
+                IfJsErrorThrow(err);
+
+                JsValueType functionType = JsUndefined;
+                IfJsErrorThrow(JsGetValueType(function, &functionType));
+                if (functionType != JsFunction)
+                {
+                    callback->sendFailure(Response::Error(c_ErrorDeclarationNotFunction));
+                    return;
+                }
+
+                result = CallFunction(
+                    function,
+                    arguments,
+                    objectGroup,
+                    in_returnByValue.fromMaybe(false),
+                    in_generatePreview.fromMaybe(false),
+                    &exceptionDetails);
+            }
+        }
+        catch (const JsErrorException& e)
+        {
+            callback->sendFailure(Response::Error(e.what()));
+            return;
+        }
+
+        callback->sendSuccess(std::move(result), std::move(exceptionDetails));
     }
 
     Response RuntimeImpl::getProperties(
         const String& in_objectId,
         Maybe<bool> /*in_ownProperties*/,
         Maybe<bool> in_accessorPropertiesOnly,
-        Maybe<bool> /*in_generatePreview*/,
+        Maybe<bool> in_generatePreview,
         std::unique_ptr<Array<PropertyDescriptor>>* out_result,
         Maybe<Array<InternalPropertyDescriptor>>* out_internalProperties,
         Maybe<ExceptionDetails>* /*out_exceptionDetails*/)
@@ -102,16 +397,72 @@ namespace JsDebug
         }
 
         auto parsedId = ProtocolHelpers::ParseObjectId(in_objectId);
+        bool generatePreview = in_generatePreview.fromMaybe(false);
 
+        int id = 0;
         int handle = 0;
         int ordinal = 0;
         String name;
 
-        if (parsedId->getInteger(PropertyHelpers::Names::Handle, &handle))
+        if (parsedId->getInteger(PropertyHelpers::Names::Id, &id))
+        {
+            JsValueRef object = JS_INVALID_REFERENCE;
+            String objectGroup;
+            if (!m_runtimeObjects.TryGet(id, &object, &objectGroup))
+            {
+                return Response::Error(c_ErrorInvalidObjectId);
+            }
+
+            try
+            {
+                // Properties of the objects returned while running are read from the objects themselves, and what
+                // they refer to goes into the same object group.
+                DebuggerContext::Scope hostScope(GetHostContext());
+                GetRuntimeObjectProperties(object, objectGroup, generatePreview, out_result);
+            }
+            catch (const JsErrorException& e)
+            {
+                // A proxy trap may have thrown; don't leave the exception pending.
+                JsValueRef exception = JS_INVALID_REFERENCE;
+                JsGetAndClearException(&exception);
+
+                return Response::Error(e.what());
+            }
+
+            return Response::OK();
+        }
+        else if (parsedId->getInteger(PropertyHelpers::Names::Handle, &handle))
         {
+            if (m_debugger->IsObjectReleased(handle))
+            {
+                return Response::Error(c_ErrorInvalidObjectId);
+            }
+
             DebuggerObject obj = m_debugger->GetObjectFromHandle(handle);
-            *out_result = obj.GetPropertyDescriptors();
-            *out_internalProperties = obj.GetInternalPropertyDescriptors();
+
+            int from = 0;
+            int count = 0;
+            if (parsedId->getInteger(PropertyHelpers::Names::From, &from) &&
+                parsedId->getInteger(PropertyHelpers::Names::Count, &count))
+            {
+                // A bucket of a large object, which only covers a range of its properties.
+                if (from < 0 || count <= 0 || count > (std::numeric_limits<int>::max)() - from)
+                {
+                    return Response::Error(c_ErrorInvalidObjectId);
+                }
+
+                *out_result = obj.GetPropertyRangeDescriptors(from, count, generatePreview);
+            }
+            else
+            {
+                GetPropertyDescriptors(obj, generatePreview, out_result, out_internalProperties);
+            }
+
+            String objectGroup;
+            if (m_debugger->TryGetObjectGroup(handle, &objectGroup))
+            {
+                AddToObjectGroup(m_debugger, objectGroup, out_result->get(), out_internalProperties);
+            }
 
             return Response::OK();
         }
@@ -123,16 +474,14 @@ namespace JsDebug
             if (name == PropertyHelpers::Names::Locals)
             {
                 DebuggerLocalScope obj = callFrame.GetLocals();
-                *out_result = obj.GetPropertyDescriptors();
-                *out_internalProperties = obj.GetInternalPropertyDescriptors();
+                GetPropertyDescriptors(obj, generatePreview, out_result, out_internalProperties);
 
                 return Response::OK();
             }
             else if (name == PropertyHelpers::Names::Globals)
             {
                 DebuggerObject obj = callFrame.GetGlobals();
-                *out_result = obj.GetPropertyDescriptors();
-                *out_internalProperties = obj.GetInternalPropertyDescriptors();
+                GetPropertyDescriptors(obj, generatePreview, out_result, out_internalProperties);
 
                 return Response::OK();
             }
@@ -141,14 +490,46 @@ namespace JsDebug
         return Response::Error(c_ErrorInvalidObjectId);
     }
 
-    Response RuntimeImpl::releaseObject(const String& /*in_objectId*/)
+    Response RuntimeImpl::releaseObject(const String& in_objectId)
     {
-        return Response::Error(c_ErrorNotImplemented);
+        auto parsedId = ProtocolHelpers::ParseObjectId(in_objectId);
+
+        int id = 0;
+        if (parsedId->getInteger(PropertyHelpers::Names::Id, &id))
+        {
+            m_runtimeObjects.Release(id);
+            return Response::OK();
+        }
+
+        int handle = 0;
+        if (!parsedId->getInteger(PropertyHelpers::Names::Handle, &handle))
+        {
+            return Response::Error(c_ErrorInvalidObjectId);
+        }
+
+        // A bucket only names a range of its parent's properties and holds nothing of its own, so releasing it must
+        // leave the parent alone.
+        int from = 0;
+        int count = 0;
+        if (parsedId->getInteger(PropertyHelpers::Names::From, &from) &&
+            parsedId->getInteger(PropertyHelpers::Names::Count, &count))
+        {
+            return Response::OK();
+        }
+
+        if (!m_debugger->ReleaseObject(handle))
+        {
+            return Response::Error(c_ErrorInvalidObjectId);
+        }
+
+        return Response::OK();
     }
 
-    Response RuntimeImpl::releaseObjectGroup(const String& /*in_objectGroup*/)
+    Response RuntimeImpl::releaseObjectGroup(const String& in_objectGroup)
     {
-        return Response::Error(c_ErrorNotImplemented);
+        m_debugger->ReleaseObjectGroup(in_objectGroup);
+        m_runtimeObjects.ReleaseGroup(in_objectGroup);
+        return Response::OK();
     }
 
     Response RuntimeImpl::runIfWaitingForDebugger()
@@ -172,11 +553,18 @@ namespace JsDebug
         m_isEnabled = true;
         // TODO: Do other setup
 
+        // Messages logged before the frontend attached are sent first, as the browsers do.
+        m_handler->ReplayConsoleMessages();
+
         return Response::OK();
     }
 
     Response RuntimeImpl::disable()
     {
+        // Objects and compiled scripts are handed out without enabling the domain, so they're released either way.
+        m_runtimeObjects.Clear();
+        m_scriptCache.Clear();
+
         if (!m_isEnabled)
         {
             return Response::OK();
@@ -190,7 +578,10 @@ namespace JsDebug
 
     Response RuntimeImpl::discardConsoleEntries()
     {
-        return Response::Error(c_ErrorNotImplemented);
+        m_handler->ClearConsoleMessages();
+        m_runtimeObjects.ReleaseGroup(c_ConsoleObjectGroup);
+
+        return Response::OK();
     }
 
     Response RuntimeImpl::setCustomObjectFormatterEnabled(bool /*in_enabled*/)
@@ -199,28 +590,115 @@ namespace JsDebug
     }
 
     Response RuntimeImpl::compileScript(
-        const String& /*in_expression*/,
-        const String& /*in_sourceURL*/,
-        bool /*in_persistScript*/,
-        Maybe<int> /*in_executionContextId*/,
-        Maybe<String>* /*out_scriptId*/,
-        Maybe<ExceptionDetails>* /*out_exceptionDetails*/)
+        const String& in_expression,
+        const String& in_sourceURL,
+        bool in_persistScript,
+        Maybe<int> in_executionContextId,
+        Maybe<String>* out_scriptId,
+        Maybe<ExceptionDetails>* out_exceptionDetails)
     {
-        return Response::Error(c_ErrorNotImplemented);
+        if (!IsValidContextId(in_executionContextId))
+        {
+            return Response::Error(c_ErrorInvalidContextId);
+        }
+
+        try
+        {
+            DebuggerContext::Scope hostScope(GetHostContext());
+
+            // Scripts that aren't persisted are cached all the same, as they are usually evaluated next.
+            String scriptId;
+            JsValueRef function = JS_INVALID_REFERENCE;
+            JsErrorCode err = m_scriptCache.Compile(in_expression, in_sourceURL, &scriptId, &function);
+
+            if (err == JsErrorScriptCompile)
+            {
+                JsValueRef exception = JS_INVALID_REFERENCE;
+                *out_exceptionDetails = GetExceptionDetails(&exception);
+                return Response::OK();
+            }
+
+            IfJsErrorThrow(err);
+
+            if (in_persistScript)
+            {
+                *out_scriptId = scriptId;
+            }
+        }
+        catch (const JsErrorException& e)
+        {
+            return Response::Error(e.what());
+        }
+
+        return Response::OK();
     }
 
     void RuntimeImpl::runScript(
-        const String& /*in_scriptId*/,
-        Maybe<int> /*in_executionContextId*/,
-        Maybe<String> /*in_objectGroup*/,
+        const String& in_scriptId,
+        Maybe<int> in_executionContextId,
+        Maybe<String> in_objectGroup,
         Maybe<bool> /*in_silent*/,
         Maybe<bool> /*in_includeCommandLineAPI*/,
-        Maybe<bool> /*in_returnByValue*/,
-        Maybe<bool> /*in_generatePreview*/,
+        Maybe<bool> in_returnByValue,
+        Maybe<bool> in_generatePreview,
         Maybe<bool> /*in_awaitPromise*/,
         std::unique_ptr<RunScriptCallback> callback)
     {
-        callback->sendFailure(Response::Error(c_ErrorNotImplemented));
+        if (!IsValidContextId(in_executionContextId))
+        {
+            callback->sendFailure(Response::Error(c_ErrorInvalidContextId));
+            return;
+        }
+
+        String source;
+        JsValueRef function = JS_INVALID_REFERENCE;
+        if (!m_scriptCache.TryGet(in_scriptId, &source, &function))
+        {
+            callback->sendFailure(Response::Error(c_ErrorInvalidScriptId));
+            return;
+        }
+
+        bool returnByValue = in_returnByValue.fromMaybe(false);
+        std::unique_ptr<RemoteObject> result;
+        Maybe<ExceptionDetails> exceptionDetails;
+
+        try
+        {
+            if (m_debugger->IsPaused())
+            {
+                result = EvaluateOnTopFrame(
+                    source,
+                    in_objectGroup,
+                    returnByValue,
+                    in_generatePreview.fromMaybe(false),
+                    &exceptionDetails);
+            }
+            else
+            {
+                DebuggerContext::Scope hostScope(GetHostContext());
+                result = CallCompiledScript(
+                    function,
+                    in_objectGroup.fromMaybe(String()),
+                    returnByValue,
+                    in_generatePreview.fromMaybe(false),
+                    &exceptionDetails);
+            }
+        }
+        catch (const JsErrorException& e)
+        {
+            callback->sendFailure(Response::Error(e.what()));
+            return;
+        }
+
+        callback->sendSuccess(std::move(result), std::move(exceptionDetails));
+    }
+
+    void RuntimeImpl::HostContextChanged()
+    {
+        // The compiled functions would otherwise keep the previous context alive.
+        m_scriptCache.Clear();
+        m_getPropertyNames = JsPersistent();
+        m_getPropertyNamesContext = JsPersistent();
     }
 
     bool RuntimeImpl::IsEnabled()
@@ -228,167 +706,324 @@ namespace JsDebug
         return m_isEnabled;
     }
 
-    JsValueRef RuntimeImpl::GetTypeString(JsValueRef object)
+    bool RuntimeImpl::IsValidContextId(const Maybe<int>& contextId)
     {
-        JsValueType type;
-        if (JsGetValueType(object, &type) != JsNoError)
+        return !contextId.isJust() || contextId.fromJust() == m_contextId;
+    }
+
+    std::unique_ptr<RemoteObject> RuntimeImpl::EvaluateOnTopFrame(
+        const String& expression,
+        const Maybe<String>& objectGroup,
+        bool returnByValue,
+        bool generatePreview,
+        Maybe<ExceptionDetails>* exceptionDetails)
+    {
+        // Script can't be run directly while paused, so evaluate in the frame the user is looking at instead.
+        std::unique_ptr<ExceptionDetails> details;
+        JsValueRef resultObject = JS_INVALID_REFERENCE;
+        auto result = m_debugger->GetCallFrame(0).Evaluate(
+            expression,
+            returnByValue,
+            generatePreview,
+            &details,
+            &resultObject);
+
+        if (objectGroup.isJust())
         {
-            return nullptr;
+            m_debugger->AddToObjectGroup(objectGroup.fromJust(), resultObject);
         }
 
-        std::string typeString;
-
-        switch (type)
-        {
-        case JsValueType::JsUndefined:
-            typeString = "undefined";
-            break;
-        case JsValueType::JsNull:
-            typeString = "null";
-            break;
-        case JsValueType::JsNumber:
-            typeString = "number";
-            break;
-        case JsValueType::JsString:
-            typeString = "string";
-            break;
-        case JsValueType::JsBoolean:
-            typeString = "boolean";
-            break;
-        case JsValueType::JsObject:
-            typeString = "object";
-            break;
-        case JsValueType::JsFunction:
-            typeString = "function";
-            break;
-        case JsValueType::JsError:
-            typeString = "error";
-            break;
-        case JsValueType::JsArray:
-            typeString = "array";
-            break;
-        case JsValueType::JsSymbol:
-            typeString = "symbol";
-            break;
-        case JsValueType::JsArrayBuffer:
-            typeString = "arraybuffer";
-            break;
-        case JsValueType::JsTypedArray:
-        case JsValueType::JsDataView:
-            typeString = "typedarray";
-            break;
-        }
-
-        if (typeString.length() != 0)
-        {
-            JsValueRef typeStringObject = JS_INVALID_REFERENCE;
-            if (JsCreateString(typeString.c_str(), typeString.length(), &typeStringObject) == JsNoError)
-            {
-                return typeStringObject;
-            }
-        }
-
-        return nullptr;
+        if (details != nullptr)
+        {
+            *exceptionDetails = std::move(details);
+        }
+
+        return result;
     }
 
-    bool RuntimeImpl::GetTypeStringAndValue(JsValueRef object, JsValueRef *typeString, JsValueRef *value)
+    std::unique_ptr<RemoteObject> RuntimeImpl::CallCompiledScript(
+        JsValueRef function,
+        const String& objectGroup,
+        bool returnByValue,
+        bool generatePreview,
+        Maybe<ExceptionDetails>* exceptionDetails)
     {
-        assert(typeString != nullptr);
-        assert(value != nullptr);
+        JsValueRef globalObject = JS_INVALID_REFERENCE;
+        IfJsErrorThrow(JsGetGlobalObject(&globalObject));
 
-        JsValueRef type = GetTypeString(object);
-        JsValueRef objectValue = object;
+        return CallFunction(function, { globalObject }, objectGroup, returnByValue, generatePreview, exceptionDetails);
+    }
 
-        if (type == nullptr)
+    std::unique_ptr<RemoteObject> RuntimeImpl::CallFunction(
+        JsValueRef function,
+        const std::vector<JsValueRef>& arguments,
+        const String& objectGroup,
+        bool returnByValue,
+        bool generatePreview,
+        Maybe<ExceptionDetails>* exceptionDetails)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+        JsErrorCode err = JsCallFunction(
+            function,
+            const_cast<JsValueRef*>(arguments.data()),
+            static_cast<unsigned short>(arguments.size()),
+            &result);
+
+        if (err == JsErrorScriptException)
         {
-            const std::string stringLiteral("string");
+            JsValueRef exception = JS_INVALID_REFERENCE;
+            *exceptionDetails = GetExceptionDetails(&exception);
+            return ProtocolHelpers::WrapValue(exception, false);
+        }
+
+        IfJsErrorThrow(err);
+        return WrapRuntimeValue(result, objectGroup, returnByValue, generatePreview);
+    }
+
+    JsErrorCode RuntimeImpl::CreateFunction(const String& declaration, JsValueRef* function)
+    {
+        // Frontends send the same few declarations over and over, so the parsed declaration is cached and only has to
+        // be run to create the function.
+        String scriptId;
+        JsValueRef script = JS_INVALID_REFERENCE;
+        JsErrorCode err = m_scriptCache.Compile("(" + declaration + "\n)", String(), &scriptId, &script);
+        if (err != JsNoError)
+        {
+            return err;
+        }
 
-            if (JsConvertValueToString(object, &objectValue) != JsNoError
-                || JsCreateString(stringLiteral.c_str(), stringLiteral.length(), &type) != JsNoError)
+        JsValueRef globalObject = JS_INVALID_REFERENCE;
+        IfJsErrorThrow(JsGetGlobalObject(&globalObject));
+
+        return JsCallFunction(script, &globalObject, 1, function);
+    }
+
+    bool RuntimeImpl::TryGetArgument(CallArgument* argument, JsValueRef* value)
+    {
+        if (argument->hasObjectId())
+        {
+            auto parsedId = ProtocolHelpers::ParseObjectId(argument->getObjectId(String()));
+
+            int id = 0;
+            return parsedId->getInteger(PropertyHelpers::Names::Id, &id) && m_runtimeObjects.TryGet(id, value, nullptr);
+        }
+
+        if (argument->hasUnserializableValue())
+        {
+            String unserializableValue = argument->getUnserializableValue(String());
+            double number = 0;
+
+            if (unserializableValue == protocol::Runtime::UnserializableValueEnum::Infinity)
             {
-                assert(false);
-                return false;
+                number = std::numeric_limits<double>::infinity();
             }
+            else if (unserializableValue == protocol::Runtime::UnserializableValueEnum::NegativeInfinity)
+            {
+                number = -std::numeric_limits<double>::infinity();
+            }
+            else if (unserializableValue == protocol::Runtime::UnserializableValueEnum::Negative0)
+            {
+                number = -0.0;
+            }
+            else
+            {
+                number = std::numeric_limits<double>::quiet_NaN();
+            }
+
+            IfJsErrorThrow(JsDoubleToNumber(number, value));
+            return true;
+        }
+
+        if (argument->hasValue())
+        {
+            *value = ToJsValue(argument->getValue(nullptr));
+            return true;
         }
 
-        *typeString = type;
-        *value = objectValue;
+        IfJsErrorThrow(JsGetUndefinedValue(value));
         return true;
     }
 
-    JsValueRef JsObjectToJson(JsValueRef value, JsValueRef* error)
+    std::unique_ptr<RemoteObject> RuntimeImpl::WrapRuntimeValue(
+        JsValueRef value,
+        const String& objectGroup,
+        bool returnByValue,
+        bool generatePreview)
     {
-        JsValueRef globalObject;
-        JsValueRef objectJson = nullptr;
-        if (JsGetGlobalObject(&globalObject) == JsNoError)
+        auto remoteObject = ProtocolHelpers::WrapValue(value, returnByValue);
+
+        // Objects sent by value have nothing left to look up. Otherwise they are kept so that the frontend can call
+        // functions on them later.
+        String type = remoteObject->getType();
+        bool isObject = (type == "object" && remoteObject->getSubtype(String()) != "null") || type == "function";
+
+        if (!returnByValue && isObject)
         {
-            JsPropertyIdRef propertyId;
-            if (JsGetPropertyIdFromName(L"JSON", &propertyId) == JsNoError)
+            remoteObject->setObjectId(ProtocolHelpers::GetRuntimeObjectId(m_runtimeObjects.Add(objectGroup, value)));
+
+            if (generatePreview)
             {
-                JsValueRef jsonObject;
-                if (JsGetProperty(globalObject, propertyId, &jsonObject) == JsNoError)
+                auto preview = ProtocolHelpers::GetValuePreview(value, *remoteObject, GetPropertyNamesFunction());
+                if (preview != nullptr)
                 {
-                    if (JsGetPropertyIdFromName(L"stringify", &propertyId) == JsNoError)
-                    {
-                        JsValueRef stringifyFunction;
-                        if (JsGetProperty(jsonObject, propertyId, &stringifyFunction) == JsNoError)
-                        {
-                            JsValueRef args[2] = { jsonObject, value };
-                            JsValueRef returnValue;
-                            if (JsCallFunction(stringifyFunction, args, _countof(args), &returnValue) == JsNoError)
-                            {
-                                objectJson = returnValue;
-                            }
-                        }
-                    }
+                    remoteObject->setPreview(std::move(preview));
                 }
             }
         }
-        JsGetAndClearException(error);
-        return objectJson;
+
+        return remoteObject;
     }
 
-    void RuntimeImpl::consoleAPICalled(protocol::String type, JsValueRef *arguments, size_t argumentCount)
+    JsValueRef RuntimeImpl::GetPropertyNamesFunction()
     {
-        assert(argumentCount > 0);
-        if (!IsEnabled())
+        // Script can't be run while paused, so previews list every name up front instead.
+        if (m_debugger->IsPaused())
         {
-            return;
+            return JS_INVALID_REFERENCE;
         }
 
-        JsValueRef remoteObject = JS_INVALID_REFERENCE;
-        if (JsCreateObject(&remoteObject) == JsNoError)
+        JsContextRef context = JS_INVALID_REFERENCE;
+        IfJsErrorThrow(JsGetCurrentContext(&context));
+
+        if (m_getPropertyNames.IsEmpty() || m_getPropertyNamesContext.Get() != context)
         {
-            std::unique_ptr<protocol::Array<protocol::Runtime::RemoteObject>> args = 
-                Array<protocol::Runtime::RemoteObject>::create();
+            JsValueRef source = JS_INVALID_REFERENCE;
+            IfJsErrorThrow(JsCreateString(c_GetPropertyNamesSource, sizeof(c_GetPropertyNamesSource) - 1, &source));
+
+            JsValueRef sourceUrl = JS_INVALID_REFERENCE;
+            IfJsErrorThrow(JsCreateString("", 0, &sourceUrl));
+
+            JsValueRef globalObject = JS_INVALID_REFERENCE;
+            IfJsErrorThrow(JsGetGlobalObject(&globalObject));
 
-            for (size_t i = 1; i < argumentCount; i++)
+            // Parsed as library code so that it isn't reported to the frontend as a script or stepped into.
+            JsValueRef script = JS_INVALID_REFERENCE;
+            JsValueRef function = JS_INVALID_REFERENCE;
+            JsErrorCode err = JsParse(
+                source,
+                JS_SOURCE_CONTEXT_NONE,
+                sourceUrl,
+                JsParseScriptAttributeLibraryCode,
+                &script);
+
+            if (err == JsNoError)
             {
-                JsValueRef typeString = JS_INVALID_REFERENCE;
-                JsValueRef objectValue = JS_INVALID_REFERENCE;
+                err = JsCallFunction(script, &globalObject, 1, &function);
+            }
 
-                if (GetTypeStringAndValue(arguments[i], &typeString, &objectValue))
-                {
-                    JsValueType valueType;
-                    JsGetValueType(objectValue, &valueType);
-                    if (valueType == JsValueType::JsObject) {
-                        JsValueRef error;
-                        JsValueRef objectJson = JsObjectToJson(objectValue, &error);
-                        if (objectJson != nullptr) {
-                            objectValue = objectJson;
-                        }
-                    }
+            if (err != JsNoError)
+            {
+                JsValueRef exception = JS_INVALID_REFERENCE;
+                JsGetAndClearException(&exception);
 
-                    PropertyHelpers::SetProperty(remoteObject, PropertyHelpers::Names::Type, typeString);
-                    PropertyHelpers::SetProperty(remoteObject, PropertyHelpers::Names::Value, objectValue);
+                return JS_INVALID_REFERENCE;
+            }
 
-                    args->addItem(ProtocolHelpers::WrapObject(remoteObject));
-                }
+            m_getPropertyNames = function;
+            m_getPropertyNamesContext = context;
+        }
+
+        return m_getPropertyNames.Get();
+    }
+
+    void RuntimeImpl::GetRuntimeObjectProperties(
+        JsValueRef object,
+        const String& objectGroup,
+        bool generatePreview,
+        std::unique_ptr<Array<PropertyDescriptor>>* propertyDescriptors)
+    {
+        *propertyDescriptors = Array<PropertyDescriptor>::create();
+
+        JsValueRef names = JS_INVALID_REFERENCE;
+        IfJsErrorThrow(JsGetOwnPropertyNames(object, &names));
+        int length = PropertyHelpers::GetPropertyInt(names, PropertyHelpers::Names::Length);
+        length = (std::min)(length, c_MaxRuntimeObjectProperties);
+
+        for (int index = 0; index < length; ++index)
+        {
+            String name;
+            JsValueRef descriptor = PropertyHelpers::GetOwnPropertyDescriptor(
+                object,
+                PropertyHelpers::GetIndexedProperty(names, index),
+                &name);
+
+            auto propertyDescriptor = PropertyDescriptor::create()
+                .setName(name)
+                .setConfigurable(PropertyHelpers::GetPropertyBool(descriptor, PropertyHelpers::Names::Configurable))
+                .setEnumerable(PropertyHelpers::GetPropertyBool(descriptor, PropertyHelpers::Names::Enumerable))
+                .setIsOwn(true)
+                .build();
+
+            // Accessors are listed as their functions, so that no getter runs just by expanding an object.
+            JsValueRef value = JS_INVALID_REFERENCE;
+            if (PropertyHelpers::TryGetProperty(descriptor, PropertyHelpers::Names::Value, &value))
+            {
+                propertyDescriptor->setValue(WrapRuntimeValue(value, objectGroup, false, generatePreview));
+                propertyDescriptor->setWritable(
+                    PropertyHelpers::GetPropertyBool(descriptor, PropertyHelpers::Names::Writable));
+            }
+            else
+            {
+                propertyDescriptor->setGet(WrapRuntimeValue(
+                    PropertyHelpers::GetProperty(descriptor, PropertyHelpers::Names::Get),
+                    objectGroup,
+                    false,
+                    false));
+                propertyDescriptor->setSet(WrapRuntimeValue(
+                    PropertyHelpers::GetProperty(descriptor, PropertyHelpers::Names::Set),
+                    objectGroup,
+                    false,
+                    false));
             }
 
-            // TODO : to get the correct context id and timestamp.
-            m_frontend.consoleAPICalled(type, std::move(args), m_contextId, m_timestamp++);
+            (*propertyDescriptors)->addItem(std::move(propertyDescriptor));
         }
     }
 
+    std::unique_ptr<ExceptionDetails> RuntimeImpl::GetExceptionDetails(JsValueRef* exception)
+    {
+        JsValueRef metadata = JS_INVALID_REFERENCE;
+        IfJsErrorThrow(JsGetAndClearExceptionWithMetadata(&metadata));
+
+        *exception = PropertyHelpers::GetProperty(metadata, PropertyHelpers::Names::Exception);
+
+        return ExceptionDetails::create()
+            .setExceptionId(++m_lastExceptionId)
+            .setText(c_DefaultExceptionText)
+            .setLineNumber(PropertyHelpers::GetPropertyInt(metadata, PropertyHelpers::Names::Line))
+            .setColumnNumber(PropertyHelpers::GetPropertyInt(metadata, PropertyHelpers::Names::Column))
+            .setException(ProtocolHelpers::WrapValue(*exception, false))
+            .build();
+    }
+
+    JsContextRef RuntimeImpl::GetHostContext()
+    {
+        JsContextRef context = m_handler->GetHostContext();
+        if (context == JS_INVALID_REFERENCE)
+        {
+            throw JsErrorException(JsErrorNoCurrentContext, c_ErrorNoHostContext);
+        }
+
+        return context;
+    }
+
+    std::unique_ptr<Array<RemoteObject>> RuntimeImpl::WrapConsoleArguments(JsValueRef* arguments, size_t argumentCount)
+    {
+        assert(argumentCount > 0);
+        if (!IsEnabled())
+        {
+            return nullptr;
+        }
+
+        // Objects are sent by reference with a short preview, so logging a large object costs no more than logging a
+        // small one. The rest is only read if the frontend expands it.
+        auto args = Array<RemoteObject>::create();
+        for (size_t i = 1; i < argumentCount; i++)
+        {
+            args->addItem(WrapRuntimeValue(arguments[i], c_ConsoleObjectGroup, false, true));
+        }
+
+        return args;
+    }
+
 }
\ No newline at end of file
@@ -4,9 +4,12 @@
 #pragma once
 
 #include "Debugger.h"
+#include "RuntimeObjects.h"
+#include "ScriptCache.h"
 
 #include <protocol\Runtime.h>
 #include <protocol\Forward.h>
+#include <vector>
 
 namespace JsDebug
 {
@@ -80,18 +83,64 @@ namespace JsDebug
             protocol::Maybe<bool> in_awaitPromise,
             std::unique_ptr<RunScriptCallback> callback) override;
 
-        void consoleAPICalled(protocol::String type, JsValueRef *arguments, size_t argumentCount);
+        // Returns null if the domain isn't enabled, in which case the frontend isn't sent console messages.
+        std::unique_ptr<protocol::Array<protocol::Runtime::RemoteObject>> WrapConsoleArguments(
+            JsValueRef* arguments,
+            size_t argumentCount);
+
+        // Drops the scripts compiled in the previous host context, which can't be run in the new one.
+        void HostContextChanged();
 
     private:
         bool IsEnabled();
-        JsValueRef GetTypeString(JsValueRef object);
-        bool GetTypeStringAndValue(JsValueRef object, JsValueRef *typeString, JsValueRef *value);
 
-        double m_timestamp;
+        bool IsValidContextId(const protocol::Maybe<int>& contextId);
+        std::unique_ptr<protocol::Runtime::RemoteObject> EvaluateOnTopFrame(
+            const protocol::String& expression,
+            const protocol::Maybe<protocol::String>& objectGroup,
+            bool returnByValue,
+            bool generatePreview,
+            protocol::Maybe<protocol::Runtime::ExceptionDetails>* exceptionDetails);
+        std::unique_ptr<protocol::Runtime::RemoteObject> CallCompiledScript(
+            JsValueRef function,
+            const protocol::String& objectGroup,
+            bool returnByValue,
+            bool generatePreview,
+            protocol::Maybe<protocol::Runtime::ExceptionDetails>* exceptionDetails);
+        std::unique_ptr<protocol::Runtime::RemoteObject> CallFunction(
+            JsValueRef function,
+            const std::vector<JsValueRef>& arguments,
+            const protocol::String& objectGroup,
+            bool returnByValue,
+            bool generatePreview,
+            protocol::Maybe<protocol::Runtime::ExceptionDetails>* exceptionDetails);
+        JsErrorCode CreateFunction(const protocol::String& declaration, JsValueRef* function);
+        bool TryGetArgument(protocol::Runtime::CallArgument* argument, JsValueRef* value);
+        JsValueRef GetPropertyNamesFunction();
+        std::unique_ptr<protocol::Runtime::RemoteObject> WrapRuntimeValue(
+            JsValueRef value,
+            const protocol::String& objectGroup,
+            bool returnByValue,
+            bool generatePreview);
+        void GetRuntimeObjectProperties(
+            JsValueRef object,
+            const protocol::String& objectGroup,
+            bool generatePreview,
+            std::unique_ptr<protocol::Array<protocol::Runtime::PropertyDescriptor>>* propertyDescriptors);
+        std::unique_ptr<protocol::Runtime::ExceptionDetails> GetExceptionDetails(JsValueRef* exception);
+        JsContextRef GetHostContext();
+
         ProtocolHandler* m_handler;
         protocol::Runtime::Frontend m_frontend;
         Debugger* m_debugger;
         int m_contextId;
         bool m_isEnabled;
+        int m_lastExceptionId;
+        ScriptCache m_scriptCache;
+        RuntimeObjects m_runtimeObjects;
+
+        // Used to list the properties of objects in previews, in the context it was created in.
+        JsPersistent m_getPropertyNames;
+        JsPersistent m_getPropertyNamesContext;
     };
 }
@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+#include "RuntimeObjects.h"
+
+namespace JsDebug
+{
+    using protocol::String;
+
+    RuntimeObjects::RuntimeObjects(size_t capacity)
+        : m_capacity(capacity)
+        , m_nextId(1)
+    {
+    }
+
+    int RuntimeObjects::Add(const String& group, JsValueRef value)
+    {
+        int id = m_nextId++;
+        m_objects.emplace(id, Entry { JsPersistent(value), group });
+        m_groups[group].insert(id);
+
+        while (m_objects.size() > m_capacity)
+        {
+            Remove(m_objects.begin());
+        }
+
+        return id;
+    }
+
+    bool RuntimeObjects::TryGet(int id, JsValueRef* value, String* group) const
+    {
+        auto it = m_objects.find(id);
+        if (it == m_objects.end())
+        {
+            return false;
+        }
+
+        *value = it->second.value.Get();
+
+        if (group != nullptr)
+        {
+            *group = it->second.group;
+        }
+
+        return true;
+    }
+
+    void RuntimeObjects::Release(int id)
+    {
+        auto it = m_objects.find(id);
+        if (it != m_objects.end())
+        {
+            Remove(it);
+        }
+    }
+
+    void RuntimeObjects::ReleaseGroup(const String& group)
+    {
+        auto it = m_groups.find(group);
+        if (it == m_groups.end())
+        {
+            return;
+        }
+
+        for (int id : it->second)
+        {
+            m_objects.erase(id);
+        }
+
+        m_groups.erase(it);
+    }
+
+    void RuntimeObjects::Clear()
+    {
+        m_objects.clear();
+        m_groups.clear();
+    }
+
+    size_t RuntimeObjects::GetObjectCount() const
+    {
+        return m_objects.size();
+    }
+
+    void RuntimeObjects::Remove(std::map<int, Entry>::iterator entry)
+    {
+        auto group = m_groups.find(entry->second.group);
+        if (group != m_groups.end())
+        {
+            group->second.erase(entry->first);
+
+            if (group->second.empty())
+            {
+                m_groups.erase(group);
+            }
+        }
+
+        m_objects.erase(entry);
+    }
+}
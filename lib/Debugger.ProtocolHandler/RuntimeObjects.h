@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "JsPersistent.h"
+
+#include <protocol/Runtime.h>
+#include <ChakraCore.h>
+
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace JsDebug
+{
+    // Keeps the values handed out to the frontend while running, such as evaluation results. Unlike debugger objects
+    // these have no engine handle, so each one gets an id of its own and is kept alive here until it's released. The
+    // oldest values are dropped once the capacity is reached, so a frontend that never releases anything can't make
+    // this grow without bound.
+    class RuntimeObjects
+    {
+    public:
+        explicit RuntimeObjects(size_t capacity);
+        RuntimeObjects(const RuntimeObjects&) = delete;
+        RuntimeObjects& operator=(const RuntimeObjects&) = delete;
+
+        // Returns the id the value can be looked up with.
+        int Add(const protocol::String& group, JsValueRef value);
+
+        // Returns false if the id was released or dropped.
+        bool TryGet(int id, JsValueRef* value, protocol::String* group) const;
+
+        void Release(int id);
+        void ReleaseGroup(const protocol::String& group);
+        void Clear();
+
+        size_t GetObjectCount() const;
+
+    private:
+        struct Entry
+        {
+            JsPersistent value;
+            protocol::String group;
+        };
+
+        void Remove(std::map<int, Entry>::iterator entry);
+
+        size_t m_capacity;
+        int m_nextId;
+
+        // Ids only ever increase, so the oldest value comes first.
+        std::map<int, Entry> m_objects;
+        std::unordered_map<protocol::String, std::unordered_set<int>> m_groups;
+    };
+}
@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+#include "ScriptCache.h"
+
+namespace JsDebug
+{
+    using protocol::String;
+
+    namespace
+    {
+        const char c_ScriptIdPrefix[] = "compiled:";
+    }
+
+    ScriptCache::ScriptCache(size_t capacity)
+        : m_capacity(capacity)
+        , m_nextId(1)
+    {
+    }
+
+    JsErrorCode ScriptCache::Compile(const String& source, const String& sourceUrl, String* scriptId, JsValueRef* function)
+    {
+        JsContextRef context = JS_INVALID_REFERENCE;
+        IfJsErrorThrow(JsGetCurrentContext(&context));
+
+        // The URL is part of the key since it shows up in stack traces. It can't contain a newline, so the two can't
+        // run together.
+        String key = sourceUrl + "\n" + source;
+
+        auto it = m_entriesByKey.find(key);
+        if (it != m_entriesByKey.end())
+        {
+            // Functions can only be called in the context they were compiled in.
+            if (it->second->context.Get() == context)
+            {
+                Touch(it->second);
+
+                *scriptId = m_entries.front().id;
+                *function = m_entries.front().function.Get();
+                return JsNoError;
+            }
+
+            Remove(it->second);
+        }
+
+        JsValueRef sourceValue = JS_INVALID_REFERENCE;
+        IfJsErrorThrow(JsCreateStringUtf16(source.characters16(), source.length(), &sourceValue));
+
+        JsValueRef sourceUrlValue = JS_INVALID_REFERENCE;
+        IfJsErrorThrow(JsCreateStringUtf16(sourceUrl.characters16(), sourceUrl.length(), &sourceUrlValue));
+
+        JsValueRef parsed = JS_INVALID_REFERENCE;
+        JsErrorCode err = JsParse(sourceValue, JS_SOURCE_CONTEXT_NONE, sourceUrlValue, JsParseScriptAttributeNone, &parsed);
+        if (err != JsNoError)
+        {
+            return err;
+        }
+
+        m_entries.push_front(Entry { key, c_ScriptIdPrefix + String::fromInteger(m_nextId++), source, context, parsed });
+        m_entriesByKey.emplace(key, m_entries.begin());
+        m_entriesById.emplace(m_entries.front().id, m_entries.begin());
+
+        while (m_entries.size() > m_capacity)
+        {
+            Remove(std::prev(m_entries.end()));
+        }
+
+        *scriptId = m_entries.front().id;
+        *function = parsed;
+        return JsNoError;
+    }
+
+    bool ScriptCache::TryGet(const String& scriptId, String* source, JsValueRef* function)
+    {
+        auto it = m_entriesById.find(scriptId);
+        if (it == m_entriesById.end())
+        {
+            return false;
+        }
+
+        Touch(it->second);
+
+        *source = m_entries.front().source;
+        *function = m_entries.front().function.Get();
+        return true;
+    }
+
+    void ScriptCache::Clear()
+    {
+        m_entriesById.clear();
+        m_entriesByKey.clear();
+        m_entries.clear();
+    }
+
+    void ScriptCache::Touch(EntryIterator entry)
+    {
+        m_entries.splice(m_entries.begin(), m_entries, entry);
+    }
+
+    void ScriptCache::Remove(EntryIterator entry)
+    {
+        m_entriesById.erase(entry->id);
+        m_entriesByKey.erase(entry->key);
+        m_entries.erase(entry);
+    }
+}
@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "JsPersistent.h"
+
+#include <protocol/Runtime.h>
+#include <ChakraCore.h>
+
+#include <iterator>
+#include <list>
+#include <unordered_map>
+
+namespace JsDebug
+{
+    // Scripts compiled on behalf of the frontend, such as watch expressions and console input. These tend to be
+    // evaluated again on every step, so the compiled functions are kept and looked up by their source. The least
+    // recently used script is dropped once the cache is full.
+    class ScriptCache
+    {
+    public:
+        explicit ScriptCache(size_t capacity);
+        ScriptCache(const ScriptCache&) = delete;
+        ScriptCache& operator=(const ScriptCache&) = delete;
+
+        // Compiles the source in the current context, or returns the function from an earlier call. On a script
+        // error the exception is left pending for the caller to collect.
+        JsErrorCode Compile(
+            const protocol::String& source,
+            const protocol::String& sourceUrl,
+            protocol::String* scriptId,
+            JsValueRef* function);
+
+        // Looks up a script returned by an earlier call to Compile, if it hasn't been dropped since.
+        bool TryGet(const protocol::String& scriptId, protocol::String* source, JsValueRef* function);
+
+        void Clear();
+
+    private:
+        struct Entry
+        {
+            protocol::String key;
+            protocol::String id;
+            protocol::String source;
+            JsPersistent context;
+            JsPersistent function;
+        };
+
+        typedef std::list<Entry>::iterator EntryIterator;
+
+        void Touch(EntryIterator entry);
+        void Remove(EntryIterator entry);
+
+        size_t m_capacity;
+        int m_nextId;
+
+        // Most recently used first.
+        std::list<Entry> m_entries;
+        std::unordered_map<protocol::String, EntryIterator> m_entriesByKey;
+        std::unordered_map<protocol::String, EntryIterator> m_entriesById;
+    };
+}
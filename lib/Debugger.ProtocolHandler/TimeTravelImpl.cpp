@@ -0,0 +1,87 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+#include "TimeTravelImpl.h"
+
+#include "ErrorHelpers.h"
+
+namespace JsDebug
+{
+    using protocol::Response;
+    using protocol::String;
+
+    namespace
+    {
+        const char c_ErrorNotPaused[] = "Can only perform operation while paused";
+        const char c_ErrorNotReplaying[] = "Can only step backwards while replaying a time-travel log";
+        const char c_ErrorUriRequired[] = "A non-empty uri must be specified";
+    }
+
+    TimeTravelImpl::TimeTravelImpl(Debugger* debugger)
+        : m_debugger(debugger)
+    {
+    }
+
+    TimeTravelImpl::~TimeTravelImpl()
+    {
+    }
+
+    Response TimeTravelImpl::writeTTDLog(const String& in_uri)
+    {
+        if (in_uri.empty())
+        {
+            return Response::Error(c_ErrorUriRequired);
+        }
+
+        // The engine writes the log through the stream callbacks the runtime was created with, so with the file
+        // stream callbacks it goes straight to disk rather than being buffered here.
+        std::string uri = in_uri.toUtf8();
+
+        JsErrorCode result = JsTTDDiagWriteLog(uri.c_str(), uri.length());
+        if (result != JsNoError)
+        {
+            return Response::Error(JsErrorException(result).what());
+        }
+
+        return Response::OK();
+    }
+
+    Response TimeTravelImpl::stepBack()
+    {
+        Response response = CheckCanMoveBackwards();
+        if (response.isSuccess())
+        {
+            m_debugger->StepBack();
+        }
+
+        return response;
+    }
+
+    Response TimeTravelImpl::reverse()
+    {
+        Response response = CheckCanMoveBackwards();
+        if (response.isSuccess())
+        {
+            m_debugger->ReverseContinue();
+        }
+
+        return response;
+    }
+
+    Response TimeTravelImpl::CheckCanMoveBackwards()
+    {
+        // The engine quietly steps forward instead when the runtime isn't replaying, so check here.
+        if (!m_debugger->IsTimeTravelReplay())
+        {
+            return Response::Error(c_ErrorNotReplaying);
+        }
+
+        if (!m_debugger->IsPaused())
+        {
+            return Response::Error(c_ErrorNotPaused);
+        }
+
+        return Response::OK();
+    }
+}
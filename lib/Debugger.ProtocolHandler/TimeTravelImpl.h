@@ -0,0 +1,31 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "Debugger.h"
+
+#include <protocol\TimeTravel.h>
+#include <protocol\Forward.h>
+
+namespace JsDebug
+{
+    class TimeTravelImpl : public protocol::TimeTravel::Backend
+    {
+    public:
+        TimeTravelImpl(Debugger* debugger);
+        ~TimeTravelImpl() override;
+        TimeTravelImpl(const TimeTravelImpl&) = delete;
+        TimeTravelImpl& operator=(const TimeTravelImpl&) = delete;
+
+        // protocol::TimeTravel::Backend implementation
+        protocol::Response writeTTDLog(const protocol::String& in_uri) override;
+        protocol::Response stepBack() override;
+        protocol::Response reverse() override;
+
+    private:
+        protocol::Response CheckCanMoveBackwards();
+
+        Debugger* m_debugger;
+    };
+}
@@ -0,0 +1,116 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+#include "TimeTravelStreams.h"
+
+#include <fstream>
+#include <string>
+
+namespace JsDebug
+{
+    namespace TimeTravelStreams
+    {
+        namespace
+        {
+            const size_t c_StreamBufferSize = 64 * 1024;
+
+            struct FileStream
+            {
+                FileStream()
+                    : buffer(new char[c_StreamBufferSize])
+                {
+                }
+
+                std::unique_ptr<char[]> buffer;
+                std::fstream stream;
+            };
+        }
+
+        JsTTDStreamHandle CHAKRA_CALLBACK OpenResourceStream(
+            size_t uriLength,
+            const char* uri,
+            size_t asciiNameLength,
+            const char* asciiResourceName,
+            bool read,
+            bool write)
+        {
+            if (uri == nullptr || asciiResourceName == nullptr || read == write)
+            {
+                return nullptr;
+            }
+
+            std::string path(uri, uriLength);
+            if (!path.empty() && path.back() != '/' && path.back() != '\\')
+            {
+                path.push_back('/');
+            }
+
+            path.append(asciiResourceName, asciiNameLength);
+
+            auto fileStream = std::make_unique<FileStream>();
+            fileStream->stream.open(
+                path,
+                std::ios::binary | (read ? std::ios::in : (std::ios::out | std::ios::trunc)));
+
+            if (!fileStream->stream.is_open())
+            {
+                return nullptr;
+            }
+
+            // The buffer is installed once the file is open and before any I/O. Some implementations only pass it on
+            // to the underlying file at that point, and ignore it when it's set on a closed stream.
+            fileStream->stream.rdbuf()->pubsetbuf(fileStream->buffer.get(), c_StreamBufferSize);
+
+            return fileStream.release();
+        }
+
+        bool CHAKRA_CALLBACK ReadBytesFromStream(
+            JsTTDStreamHandle handle,
+            byte* buff,
+            size_t size,
+            size_t* readCount)
+        {
+            if (handle == nullptr || readCount == nullptr)
+            {
+                return false;
+            }
+
+            auto fileStream = static_cast<FileStream*>(handle);
+            fileStream->stream.read(reinterpret_cast<char*>(buff), static_cast<std::streamsize>(size));
+
+            *readCount = static_cast<size_t>(fileStream->stream.gcount());
+            return *readCount == size;
+        }
+
+        bool CHAKRA_CALLBACK WriteBytesToStream(
+            JsTTDStreamHandle handle,
+            const byte* data,
+            size_t size,
+            size_t* writtenCount)
+        {
+            if (handle == nullptr || writtenCount == nullptr)
+            {
+                return false;
+            }
+
+            auto fileStream = static_cast<FileStream*>(handle);
+            fileStream->stream.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+
+            bool success = !fileStream->stream.fail();
+            *writtenCount = success ? size : 0;
+            return success;
+        }
+
+        void CHAKRA_CALLBACK FlushAndCloseStream(JsTTDStreamHandle handle, bool /*read*/, bool /*write*/)
+        {
+            // Take ownership of the pointer so that it gets released at the exit of the function.
+            auto fileStream = std::unique_ptr<FileStream>(static_cast<FileStream*>(handle));
+
+            if (fileStream != nullptr)
+            {
+                fileStream->stream.close();
+            }
+        }
+    }
+}
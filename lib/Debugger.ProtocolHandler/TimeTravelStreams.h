@@ -0,0 +1,37 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <ChakraCore.h>
+
+namespace JsDebug
+{
+    // File-backed implementations of the time-travel stream callbacks. The uri given by the engine is treated as a
+    // directory and each resource is a file within it. Data is written through a fixed-size buffer, so the size of a
+    // recording is not limited by memory.
+    namespace TimeTravelStreams
+    {
+        JsTTDStreamHandle CHAKRA_CALLBACK OpenResourceStream(
+            size_t uriLength,
+            const char* uri,
+            size_t asciiNameLength,
+            const char* asciiResourceName,
+            bool read,
+            bool write);
+
+        bool CHAKRA_CALLBACK ReadBytesFromStream(
+            JsTTDStreamHandle handle,
+            byte* buff,
+            size_t size,
+            size_t* readCount);
+
+        bool CHAKRA_CALLBACK WriteBytesToStream(
+            JsTTDStreamHandle handle,
+            const byte* data,
+            size_t size,
+            size_t* writtenCount);
+
+        void CHAKRA_CALLBACK FlushAndCloseStream(JsTTDStreamHandle handle, bool read, bool write);
+    }
+}
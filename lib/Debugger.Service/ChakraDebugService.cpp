@@ -58,6 +58,31 @@ CHAKRA_API JsDebugServiceUnregisterHandler(JsDebugService service, const char* i
         });
 }
 
+CHAKRA_API JsDebugServiceGetHandlerStats(JsDebugService service, const char* id, JsDebugServiceHandlerStats* stats)
+{
+    if (id == nullptr || stats == nullptr)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    return JsDebug::TranslateExceptionToJsErrorCode<JsDebug::Service*>(
+        service,
+        [&](JsDebug::Service* instance) -> void
+        {
+            instance->GetHandlerStats(id, stats);
+        });
+}
+
+CHAKRA_API JsDebugServiceSetThreadCount(JsDebugService service, uint32_t threadCount)
+{
+    return JsDebug::TranslateExceptionToJsErrorCode<JsDebug::Service*>(
+        service,
+        [&](JsDebug::Service* instance) -> void
+        {
+            instance->SetThreadCount(threadCount);
+        });
+}
+
 CHAKRA_API JsDebugServiceListen(JsDebugService service, uint16_t port)
 {
     return JsDebug::TranslateExceptionToJsErrorCode<JsDebug::Service*>(
@@ -68,6 +93,57 @@ CHAKRA_API JsDebugServiceListen(JsDebugService service, uint16_t port)
         });
 }
 
+CHAKRA_API JsDebugServiceConnectClient(
+    JsDebugService service,
+    const char* id,
+    JsDebugServiceClientMessageCallback callback,
+    void* callbackState,
+    JsDebugServiceClient* client)
+{
+    if (id == nullptr || callback == nullptr || client == nullptr)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    return JsDebug::TranslateExceptionToJsErrorCode<JsDebug::Service*>(
+        service,
+        [&](JsDebug::Service* instance) -> void
+        {
+            auto connection = std::make_unique<std::shared_ptr<JsDebug::InProcessConnection>>(
+                instance->ConnectClient(id, callback, callbackState));
+
+            // Release ownership of the pointer
+            *client = reinterpret_cast<JsDebugServiceClient>(connection.release());
+        });
+}
+
+CHAKRA_API JsDebugServiceClientSendCommand(JsDebugServiceClient client, const char* command)
+{
+    if (command == nullptr)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    return JsDebug::TranslateExceptionToJsErrorCode<std::shared_ptr<JsDebug::InProcessConnection>*>(
+        client,
+        [&](std::shared_ptr<JsDebug::InProcessConnection>* connection) -> void
+        {
+            (*connection)->Receive(command);
+        });
+}
+
+CHAKRA_API JsDebugServiceDisconnectClient(JsDebugServiceClient client)
+{
+    return JsDebug::TranslateExceptionToJsErrorCode<std::shared_ptr<JsDebug::InProcessConnection>*>(
+        client,
+        [&](std::shared_ptr<JsDebug::InProcessConnection>* connection) -> void
+        {
+            // Take ownership of the pointer so that it gets released at the exit of the function.
+            auto holder = std::unique_ptr<std::shared_ptr<JsDebug::InProcessConnection>>(connection);
+            (*connection)->Close();
+        });
+}
+
 CHAKRA_API JsDebugServiceClose(JsDebugService service)
 {
     return JsDebug::TranslateExceptionToJsErrorCode<JsDebug::Service*>(
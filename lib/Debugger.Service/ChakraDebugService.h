@@ -7,6 +7,32 @@
 #include <ChakraDebugProtocolHandler.h>
 
 typedef struct JsDebugService__* JsDebugService;
+typedef struct JsDebugServiceClient__* JsDebugServiceClient;
+
+/// <summary>Called when a handler sends a message to an in-process client.</summary>
+/// <param name="message">The message, which is only valid for the duration of the call.</param>
+/// <param name="callbackState">The state passed to <c>JsDebugServiceConnectClient</c>.</param>
+typedef void (CHAKRA_CALLBACK *JsDebugServiceClientMessageCallback)(const char* message, void* callbackState);
+
+/// <summary>Outbound message statistics for the current connection of a registered handler.</summary>
+typedef struct JsDebugServiceHandlerStats
+{
+    /// <summary>Messages held back because the client isn't reading fast enough.</summary>
+    size_t queuedMessages;
+    /// <summary>Total size of the messages held back.</summary>
+    size_t queuedBytes;
+    /// <summary>Largest total size of held back messages seen on this connection.</summary>
+    size_t peakQueuedBytes;
+    /// <summary>Bytes handed to the socket that haven't been written yet.</summary>
+    size_t bufferedBytes;
+    /// <summary>Messages sent on this connection.</summary>
+    uint64_t sentMessages;
+    /// <summary>
+    ///     Low-priority notifications dropped while messages were held back, plus any messages discarded when a client
+    ///     that stopped reading was disconnected.
+    /// </summary>
+    uint64_t droppedMessages;
+} JsDebugServiceHandlerStats;
 
 /// <summary>Creates a <seealso cref="JsDebugProtocolHandler" /> instance.</summary>
 /// <param name="service">The newly created instance.</param>
@@ -36,12 +62,68 @@ CHAKRA_API JsDebugServiceRegisterHandler(
 /// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
 CHAKRA_API JsDebugServiceUnregisterHandler(_In_ JsDebugService service, _In_z_ const char* id);
 
+/// <summary>Gets the outbound message statistics for the current connection of a registered handler.</summary>
+/// <remarks>
+///     All values are zero if no debugger is connected to the handler.
+/// </remarks>
+/// <param name="service">The instance the handler is registered with.</param>
+/// <param name="id">The ID of the handler.</param>
+/// <param name="stats">The statistics.</param>
+/// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
+CHAKRA_API JsDebugServiceGetHandlerStats(
+    _In_ JsDebugService service,
+    _In_z_ const char* id,
+    _Out_ JsDebugServiceHandlerStats* stats);
+
+/// <summary>Sets the number of threads that service connections once the instance starts listening.</summary>
+/// <remarks>
+///     This must be called before <c>JsDebugServiceListen</c>. It defaults to a single thread. Requests on a single
+///     connection are always handled in order, but with more threads a slow connection doesn't hold up the others.
+/// </remarks>
+/// <param name="service">The instance to configure.</param>
+/// <param name="threadCount">The number of threads, which must be greater than zero.</param>
+/// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
+CHAKRA_API JsDebugServiceSetThreadCount(_In_ JsDebugService service, _In_ uint32_t threadCount);
+
 /// <summary>Start listening on a given port.</summary>
 /// <param name="service">The instance to listen with.</param>
 /// <param name="port">The port number to listen on.</param>
 /// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
 CHAKRA_API JsDebugServiceListen(_In_ JsDebugService service, _In_ uint16_t port);
 
+/// <summary>Connects a client in the same process to a registered handler, without going through a socket.</summary>
+/// <remarks>
+///     Messages from the handler are passed to the callback on the thread that sends them, which is normally the
+///     script thread while it processes the command queue. The client takes the place of a remote debugger, so the
+///     call fails if one is already connected.
+/// </remarks>
+/// <param name="service">The instance the handler is registered with.</param>
+/// <param name="id">The ID of the handler.</param>
+/// <param name="callback">The callback that receives messages from the handler.</param>
+/// <param name="callbackState">The state passed to the callback.</param>
+/// <param name="client">The newly connected client.</param>
+/// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
+CHAKRA_API JsDebugServiceConnectClient(
+    _In_ JsDebugService service,
+    _In_z_ const char* id,
+    _In_ JsDebugServiceClientMessageCallback callback,
+    _In_opt_ void* callbackState,
+    _Out_ JsDebugServiceClient* client);
+
+/// <summary>Sends a command from an in-process client to its handler.</summary>
+/// <remarks>
+///     The command is ignored if the handler has been unregistered since the client connected.
+/// </remarks>
+/// <param name="client">The client to send from.</param>
+/// <param name="command">The command to send.</param>
+/// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
+CHAKRA_API JsDebugServiceClientSendCommand(_In_ JsDebugServiceClient client, _In_z_ const char* command);
+
+/// <summary>Disconnects an in-process client from its handler and destroys it.</summary>
+/// <param name="client">The client to disconnect.</param>
+/// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
+CHAKRA_API JsDebugServiceDisconnectClient(_In_ JsDebugServiceClient client);
+
 /// <summary>Stop listening and close any connections.</summary>
 /// <param name="service">The instance to close.</param>
 /// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
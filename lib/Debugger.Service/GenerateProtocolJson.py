@@ -0,0 +1,57 @@
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License.
+
+#!/usr/bin/env python
+
+# Embeds the protocol description served from /json/protocol into a header, both as-is and gzip compressed so that it
+# never has to be compressed at runtime.
+
+import argparse
+import gzip
+import io
+import os
+import sys
+
+BYTES_PER_LINE = 16
+
+def write_array(output, name, data):
+    output.write("        const unsigned char %s[] =\n        {\n" % name)
+    for offset in range(0, len(data), BYTES_PER_LINE):
+        line = ", ".join("0x%02x" % b for b in bytearray(data[offset:offset + BYTES_PER_LINE]))
+        output.write("            %s,\n" % line)
+    output.write("        };\n")
+
+def compress(data):
+    buffer = io.BytesIO()
+    # A fixed timestamp keeps the output identical between runs.
+    with gzip.GzipFile(fileobj=buffer, mode="wb", compresslevel=9, mtime=0) as stream:
+        stream.write(data)
+    return buffer.getvalue()
+
+try:
+    cmdline_parser = argparse.ArgumentParser()
+    cmdline_parser.add_argument("--protocol", required=True)
+    cmdline_parser.add_argument("--output", required=True)
+    arg_options = cmdline_parser.parse_args()
+except Exception:
+    exc = sys.exc_info()[1]
+    sys.stderr.write("Failed to parse command-line arguments: %s\n\n" % exc)
+    exit(1)
+
+with open(arg_options.protocol, "rb") as stream:
+    protocol = stream.read().replace(b"\r\n", b"\n")
+
+output_dir = os.path.dirname(arg_options.output)
+if output_dir and not os.path.isdir(output_dir):
+    os.makedirs(output_dir)
+
+with open(arg_options.output, "w") as output:
+    output.write("// Copyright (c) Microsoft Corporation. All rights reserved.\n")
+    output.write("// Licensed under the MIT License.\n\n")
+    output.write("// This file is generated by GenerateProtocolJson.py from js_protocol.json, do not edit.\n\n")
+    output.write("#pragma once\n\n")
+    output.write("namespace JsDebug\n{\n    namespace ProtocolJson\n    {\n")
+    write_array(output, "c_Document", protocol)
+    output.write("\n")
+    write_array(output, "c_DocumentGzip", compress(protocol))
+    output.write("    }\n}\n")
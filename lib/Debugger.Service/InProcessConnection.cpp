@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+#include "InProcessConnection.h"
+#include "ServiceHandler.h"
+
+namespace JsDebug
+{
+    using websocketpp::lib::mutex;
+    using websocketpp::lib::unique_lock;
+
+    InProcessConnection::InProcessConnection(JsDebugServiceClientMessageCallback callback, void* callbackState)
+        : m_handler(nullptr)
+        , m_activeCalls(0)
+        , m_callback(callback)
+        , m_callbackState(callbackState)
+        , m_sentCount(0)
+    {
+    }
+
+    void InProcessConnection::Receive(const char* message)
+    {
+        ServiceHandler* handler = BeginCall(false);
+
+        if (handler != nullptr)
+        {
+            handler->OnMessage(message);
+            EndCall();
+        }
+    }
+
+    void InProcessConnection::SetHandler(ServiceHandler* handler)
+    {
+        unique_lock<mutex> lock(m_lock);
+        m_handler = handler;
+
+        if (handler == nullptr)
+        {
+            m_callsFinished.wait(lock, [this]() { return m_activeCalls == 0; });
+        }
+    }
+
+    void InProcessConnection::Send(const char* message)
+    {
+        m_callback(message, m_callbackState);
+        ++m_sentCount;
+    }
+
+    void InProcessConnection::GetStats(JsDebugServiceHandlerStats* stats)
+    {
+        // Messages are handed straight to the callback, so nothing is ever queued or dropped.
+        *stats = JsDebugServiceHandlerStats();
+        stats->sentMessages = m_sentCount;
+    }
+
+    void InProcessConnection::Close()
+    {
+        ServiceHandler* handler = BeginCall(true);
+
+        if (handler != nullptr)
+        {
+            handler->OnClose(this);
+            EndCall();
+        }
+    }
+
+    ServiceHandler* InProcessConnection::BeginCall(bool detach)
+    {
+        unique_lock<mutex> lock(m_lock);
+
+        ServiceHandler* handler = m_handler;
+        if (handler != nullptr)
+        {
+            ++m_activeCalls;
+
+            if (detach)
+            {
+                m_handler = nullptr;
+            }
+        }
+
+        return handler;
+    }
+
+    void InProcessConnection::EndCall()
+    {
+        unique_lock<mutex> lock(m_lock);
+
+        if (--m_activeCalls == 0)
+        {
+            m_callsFinished.notify_all();
+        }
+    }
+}
@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ServiceConnection.h"
+
+#include <atomic>
+
+namespace JsDebug
+{
+    // A client in the same process that exchanges messages with a handler through callbacks, without any socket in
+    // between. Responses are delivered on whichever thread the protocol handler sends them from, which is normally the
+    // script thread.
+    class InProcessConnection : public ServiceConnection
+    {
+    public:
+        InProcessConnection(JsDebugServiceClientMessageCallback callback, void* callbackState);
+        InProcessConnection(const InProcessConnection&) = delete;
+        InProcessConnection& operator=(const InProcessConnection&) = delete;
+
+        // Passes a message from the client to the handler.
+        void Receive(const char* message);
+
+        // Detaching waits for calls into the previous handler on other threads to return, so that it can be destroyed
+        // right after. It must not be called from those calls.
+        void SetHandler(ServiceHandler* handler) override;
+        void Send(const char* message) override;
+        void GetStats(JsDebugServiceHandlerStats* stats) override;
+        void Close() override;
+
+    private:
+        ServiceHandler* BeginCall(bool detach);
+        void EndCall();
+
+        // The handler is called without holding the lock, since it takes its own lock and calls back into this
+        // connection. Calls in progress are counted instead.
+        websocketpp::lib::mutex m_lock;
+        websocketpp::lib::condition_variable m_callsFinished;
+        ServiceHandler* m_handler;
+        int m_activeCalls;
+
+        JsDebugServiceClientMessageCallback m_callback;
+        void* m_callbackState;
+        std::atomic<uint64_t> m_sentCount;
+    };
+}
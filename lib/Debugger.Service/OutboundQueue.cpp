@@ -0,0 +1,141 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+#include "OutboundQueue.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace JsDebug
+{
+    namespace
+    {
+        const char* const c_LowPriorityPrefixes[] =
+        {
+            "{\"method\":\"Runtime.consoleAPICalled\"",
+            "{\"method\":\"Console.messageAdded\"",
+        };
+    }
+
+    OutboundQueue::OutboundQueue(size_t lowWatermarkBytes, size_t highWatermarkBytes, size_t maxQueuedBytes)
+        : m_lowWatermarkBytes(lowWatermarkBytes)
+        , m_highWatermarkBytes(highWatermarkBytes)
+        , m_maxQueuedBytes(maxQueuedBytes)
+        , m_queuedBytes(0)
+        , m_peakQueuedBytes(0)
+        , m_droppedCount(0)
+        , m_isBacklogged(false)
+        , m_isDraining(false)
+    {
+    }
+
+    OutboundQueue::PushResult OutboundQueue::Push(const char* message, size_t length, size_t bufferedAmount)
+    {
+        if (!m_isBacklogged)
+        {
+            if (bufferedAmount < m_highWatermarkBytes)
+            {
+                return PushResult::Send;
+            }
+
+            m_isBacklogged = true;
+        }
+
+        if (IsLowPriority(message))
+        {
+            ++m_droppedCount;
+            return PushResult::Dropped;
+        }
+
+        // Responses and other notifications can't be dropped on their own, since the client would be left waiting for
+        // them. A client that falls this far behind isn't going to catch up, so the connection is given up instead.
+        if (m_queuedBytes + length > m_maxQueuedBytes)
+        {
+            m_droppedCount += m_messages.size() + 1;
+            Clear();
+
+            return PushResult::Overflow;
+        }
+
+        m_messages.emplace_back(message, length);
+        m_queuedBytes += length;
+        m_peakQueuedBytes = (std::max)(m_peakQueuedBytes, m_queuedBytes);
+
+        return PushResult::Queued;
+    }
+
+    bool OutboundQueue::TryPop(size_t bufferedAmount, std::string& message)
+    {
+        if (m_messages.empty())
+        {
+            m_isBacklogged = false;
+            m_isDraining = false;
+            return false;
+        }
+
+        // Hold back until the transport has mostly caught up, then refill it up to the high watermark.
+        if (!m_isDraining)
+        {
+            if (bufferedAmount >= m_lowWatermarkBytes)
+            {
+                return false;
+            }
+
+            m_isDraining = true;
+        }
+
+        if (bufferedAmount >= m_highWatermarkBytes)
+        {
+            m_isDraining = false;
+            return false;
+        }
+
+        message = std::move(m_messages.front());
+        m_messages.pop_front();
+        m_queuedBytes -= message.length();
+
+        return true;
+    }
+
+    void OutboundQueue::Clear()
+    {
+        m_messages.clear();
+        m_queuedBytes = 0;
+        m_isBacklogged = false;
+        m_isDraining = false;
+    }
+
+    size_t OutboundQueue::GetQueuedMessages() const
+    {
+        return m_messages.size();
+    }
+
+    size_t OutboundQueue::GetQueuedBytes() const
+    {
+        return m_queuedBytes;
+    }
+
+    size_t OutboundQueue::GetPeakQueuedBytes() const
+    {
+        return m_peakQueuedBytes;
+    }
+
+    uint64_t OutboundQueue::GetDroppedMessages() const
+    {
+        return m_droppedCount;
+    }
+
+    bool OutboundQueue::IsLowPriority(const char* message)
+    {
+        for (const char* prefix : c_LowPriorityPrefixes)
+        {
+            if (std::strncmp(message, prefix, std::strlen(prefix)) == 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
@@ -0,0 +1,61 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+
+namespace JsDebug
+{
+    // Decides which outbound messages are handed to the transport straight away, which are held back and which are
+    // dropped. Once the transport's buffered amount reaches the high watermark, messages are held back until it falls
+    // under the low watermark. While held back, low-priority notifications such as console messages are dropped, and if
+    // the held back messages would exceed the limit the client is considered stalled. Not thread safe.
+    class OutboundQueue
+    {
+    public:
+        enum class PushResult
+        {
+            // The caller should send the message now.
+            Send,
+            Queued,
+            Dropped,
+            // The limit was reached. Everything held back has been discarded and the caller should close the
+            // connection.
+            Overflow,
+        };
+
+        OutboundQueue(size_t lowWatermarkBytes, size_t highWatermarkBytes, size_t maxQueuedBytes);
+        OutboundQueue(const OutboundQueue&) = delete;
+        OutboundQueue& operator=(const OutboundQueue&) = delete;
+
+        PushResult Push(const char* message, size_t length, size_t bufferedAmount);
+
+        // Moves the next held back message into the given string if the transport can take it. Call this whenever the
+        // buffered amount falls, such as after each completed write.
+        bool TryPop(size_t bufferedAmount, std::string& message);
+
+        void Clear();
+
+        size_t GetQueuedMessages() const;
+        size_t GetQueuedBytes() const;
+        size_t GetPeakQueuedBytes() const;
+        uint64_t GetDroppedMessages() const;
+
+        static bool IsLowPriority(const char* message);
+
+    private:
+        const size_t m_lowWatermarkBytes;
+        const size_t m_highWatermarkBytes;
+        const size_t m_maxQueuedBytes;
+
+        std::deque<std::string> m_messages;
+        size_t m_queuedBytes;
+        size_t m_peakQueuedBytes;
+        uint64_t m_droppedCount;
+        bool m_isBacklogged;
+        bool m_isDraining;
+    };
+}
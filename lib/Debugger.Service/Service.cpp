@@ -3,12 +3,19 @@
 
 #include "stdafx.h"
 #include "Service.h"
+#include "Generated/ProtocolJson.h"
 
+#include <ErrorHelpers.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <iterator>
 
 namespace JsDebug
 {
-    typedef websocketpp::server<websocketpp::config::asio> server;
+    typedef ServiceServer server;
 
     using websocketpp::connection_hdl;
 
@@ -23,19 +30,101 @@ namespace JsDebug
 
     namespace
     {
+        const char c_ErrorAlreadyListening[] = "The service is already listening";
+        const char c_ErrorHandlerAlreadyConnected[] = "A debugger is already connected to the handler";
+        const char c_ErrorHandlerNotFound[] = "No handler is registered with the given id";
+        const char c_ErrorInvalidThreadCount[] = "'threadCount' must be greater than zero";
+        const char c_HeaderAcceptEncodingName[] = "Accept-Encoding";
         const char c_HeaderCacheControlName[] = "Cache-Control";
         const char c_HeaderCacheControlValue[] = "no-cache";
         const char c_HeaderContentTypeName[] = "Content-Type";
         const char c_HeaderContentTypeValue[] = "application/json; charset=UTF-8";
+        const char c_HeaderContentEncodingName[] = "Content-Encoding";
+        const char c_HeaderVaryName[] = "Vary";
+        const char c_EncodingGzip[] = "gzip";
+        const char c_EncodingAny[] = "*";
         const char c_LocalHostName[] = "127.0.0.1";
         const char c_ResourceJson[] = "/json";
         const char c_ResourceJsonList[] = "/json/list";
         const char c_ResourceJsonProtocol[] = "/json/protocol";
         const char c_ResourceJsonVersion[] = "/json/version";
+
+        std::string Trim(const std::string& value)
+        {
+            size_t start = value.find_first_not_of(" \t");
+            if (start == std::string::npos)
+            {
+                return std::string();
+            }
+
+            return value.substr(start, value.find_last_not_of(" \t") + 1 - start);
+        }
+
+        bool EqualsIgnoreCase(const std::string& value, const char* expected)
+        {
+            return std::equal(value.begin(), value.end(), expected, expected + std::strlen(expected),
+                [](char left, char right)
+                {
+                    return std::tolower(static_cast<unsigned char>(left)) ==
+                        std::tolower(static_cast<unsigned char>(right));
+                });
+        }
+
+        // Reads an Accept-Encoding header as a list of codings, each with optional parameters. A coding is only
+        // accepted if it's listed by name, or covered by "*", without a quality of zero.
+        bool IsEncodingAccepted(const std::string& acceptEncoding, const char* encoding)
+        {
+            int accepted = -1;
+            int acceptedByAny = -1;
+            size_t start = 0;
+
+            while (start <= acceptEncoding.length())
+            {
+                size_t end = acceptEncoding.find(',', start);
+                if (end == std::string::npos)
+                {
+                    end = acceptEncoding.length();
+                }
+
+                std::string item = acceptEncoding.substr(start, end - start);
+                start = end + 1;
+
+                size_t parameters = item.find(';');
+                std::string coding = Trim(item.substr(0, parameters));
+                bool isAccepted = true;
+
+                while (parameters != std::string::npos)
+                {
+                    size_t next = item.find(';', parameters + 1);
+                    std::string parameter = Trim(item.substr(parameters + 1, next - parameters - 1));
+                    parameters = next;
+
+                    if (parameter.length() > 2 && EqualsIgnoreCase(parameter.substr(0, 2), "q="))
+                    {
+                        isAccepted = std::strtod(parameter.c_str() + 2, nullptr) > 0;
+                    }
+                }
+
+                if (EqualsIgnoreCase(coding, encoding))
+                {
+                    accepted = isAccepted ? 1 : 0;
+                }
+                else if (coding == c_EncodingAny)
+                {
+                    acceptedByAny = isAccepted ? 1 : 0;
+                }
+            }
+
+            return accepted != -1 ? accepted == 1 : acceptedByAny == 1;
+        }
     }
 
     Service::Service()
-        : m_port(0)
+        : m_threadCount(1)
+        , m_port(0)
+        , m_versionDocument(BuildVersionDocument())
+        , m_protocolDocument(std::begin(ProtocolJson::c_Document), std::end(ProtocolJson::c_Document))
+        , m_protocolDocumentGzip(std::begin(ProtocolJson::c_DocumentGzip), std::end(ProtocolJson::c_DocumentGzip))
     {
         // TODO: Enable logging to a file
         m_server.set_error_channels(elevel::none);
@@ -44,6 +133,8 @@ namespace JsDebug
         m_server.init_asio();
         m_server.set_validate_handler(bind(&Service::OnValidate, this, _1));
         m_server.set_http_handler(bind(&Service::OnHttpRequest, this, _1));
+
+        UpdateListDocument();
     }
 
     Service::~Service()
@@ -62,44 +153,141 @@ namespace JsDebug
     void Service::RegisterHandler(const char* id, JsDebugProtocolHandler protocolHandler, bool breakOnNextLine)
     {
         unique_lock<mutex> lock(m_lock);
-        m_handlers.emplace(id, std::make_unique<ServiceHandler>(&m_server, id, protocolHandler, breakOnNextLine));
+        m_handlers.emplace(id, std::make_unique<ServiceHandler>(id, protocolHandler, breakOnNextLine));
+        UpdateListDocument();
     }
 
     void Service::UnregisterHandler(const char* id)
     {
         unique_lock<mutex> lock(m_lock);
         m_handlers.erase(id);
+        UpdateListDocument();
+    }
+
+    void Service::GetHandlerStats(const char* id, JsDebugServiceHandlerStats* stats)
+    {
+        unique_lock<mutex> lock(m_lock);
+
+        auto handler = m_handlers.find(id);
+        if (handler == m_handlers.end())
+        {
+            throw JsErrorException(JsErrorInvalidArgument, c_ErrorHandlerNotFound);
+        }
+
+        handler->second->GetStats(stats);
+    }
+
+    void Service::SetThreadCount(uint32_t threadCount)
+    {
+        if (threadCount == 0)
+        {
+            throw JsErrorException(JsErrorInvalidArgument, c_ErrorInvalidThreadCount);
+        }
+
+        if (!m_threads.empty())
+        {
+            throw std::runtime_error(c_ErrorAlreadyListening);
+        }
+
+        m_threadCount = threadCount;
     }
 
     void Service::Listen(uint16_t port)
     {
-        m_port = port;
+        if (m_server.is_listening())
+        {
+            throw std::runtime_error(c_ErrorAlreadyListening);
+        }
 
-        m_server.listen(c_LocalHostName, std::to_string(m_port));
+        m_server.listen(c_LocalHostName, std::to_string(port));
         m_server.start_accept();
 
-        m_thread = thread(&server::run, &m_server);
+        {
+            unique_lock<mutex> lock(m_lock);
+            m_port = port;
+            UpdateListDocument();
+        }
+
+        StartThreads();
     }
 
     void Service::Close()
     {
         // Stop listening for new connections
-        m_server.stop_listening();
-        m_port = 0;
+        if (m_server.is_listening())
+        {
+            m_server.stop_listening();
+        }
 
         {
             unique_lock<mutex> lock(m_lock);
 
+            m_port = 0;
+            UpdateListDocument();
+
             for (const auto& handler : m_handlers)
             {
                 handler.second->Disconnect();
             }
         }
 
-        // Wait for the thread to exit
-        if (m_thread.joinable()) {
-            m_thread.join();
+        // Wait for the threads to exit
+        for (auto& thread : m_threads)
+        {
+            if (thread.joinable())
+            {
+                thread.join();
+            }
+        }
+
+        m_threads.clear();
+    }
+
+    std::shared_ptr<InProcessConnection> Service::ConnectClient(
+        const char* id,
+        JsDebugServiceClientMessageCallback callback,
+        void* callbackState)
+    {
+        auto connection = std::make_shared<InProcessConnection>(callback, callbackState);
+
+        unique_lock<mutex> lock(m_lock);
+
+        auto handler = m_handlers.find(id);
+        if (handler == m_handlers.end())
+        {
+            throw JsErrorException(JsErrorInvalidArgument, c_ErrorHandlerNotFound);
+        }
+
+        if (!handler->second->Connect(connection))
+        {
+            throw std::runtime_error(c_ErrorHandlerAlreadyConnected);
+        }
+
+        return connection;
+    }
+
+    void Service::StartThreads()
+    {
+        if (m_threads.empty())
+        {
+            for (uint32_t i = 0; i < m_threadCount; ++i)
+            {
+                m_threads.emplace_back(&server::run, &m_server);
+            }
+        }
+    }
+
+    bool Service::ConnectHandler(const std::string& id, std::shared_ptr<ServiceConnection> connection)
+    {
+        unique_lock<mutex> lock(m_lock);
+
+        auto handler = m_handlers.find(id);
+        if (handler != m_handlers.end())
+        {
+            return handler->second->Connect(connection);
         }
+
+        return false;
     }
 
     bool Service::OnValidate(connection_hdl hdl)
@@ -110,14 +298,7 @@ namespace JsDebug
             auto resource = connection->get_uri()->get_resource();
             resource.erase(0, 1);
 
-            {
-                unique_lock<mutex> lock(m_lock);
-
-                auto handler = m_handlers.find(resource);
-                if (handler != m_handlers.end()) {
-                    return handler->second->Connect(hdl);
-                }
-            }
+            return ConnectHandler(resource, std::make_shared<WebSocketConnection>(&m_server, hdl));
         }
 
         return false;
@@ -151,49 +332,37 @@ namespace JsDebug
 
     void Service::HandleListRequest(connection_hdl hdl)
     {
-        bool first = true;
-        std::ostringstream json;
-        json << "[";
+        auto document = std::atomic_load(&m_listDocument);
+        SendHttpJsonResponse(hdl, *document);
+    }
 
+    void Service::HandleProtocolRequest(connection_hdl hdl)
+    {
+        auto connection = m_server.get_con_from_hdl(hdl);
+        if (connection != nullptr)
         {
-            unique_lock<mutex> lock(m_lock);
+            // Both responses vary by encoding, so caches must not hand the plain one to clients that asked for gzip.
+            connection->append_header(c_HeaderVaryName, c_HeaderAcceptEncodingName);
 
-            for (const auto& handler : m_handlers) {
-                if (first)
-                {
-                    first = false;
-                }
-                else
-                {
-                    json << ",";
-                }
-
-                // TODO: Tweak these values to be more accurate.
-                json << " {\n";
-                json << "  \"description\": \"ChakraCore instance\",\n";
-                json << "  \"devtoolsFrontendUrl\": " <<
-                    "\"chrome-devtools://devtools/bundled/inspector.html?experiments=true&v8only=true&ws=localhost:" <<
-                    m_port << "/" << handler.second->Id() << "\",\n";
-                json << "  \"id\": \"" << handler.second->Id() << "\",\n";
-                json << "  \"title\": \"ChakraCore instance\",\n";
-                json << "  \"type\": \"node\",\n";
-                json << "  \"url\": \"file://\",\n";
-                json << "  \"webSocketDebuggerUrl\": \"ws://localhost:" << m_port << "/" << handler.second->Id() << "\"\n";
-                json << "}";
+            // The DevTools frontend always accepts gzip, so the compressed copy is what's normally sent.
+            if (IsEncodingAccepted(connection->get_request_header(c_HeaderAcceptEncodingName), c_EncodingGzip))
+            {
+                connection->append_header(c_HeaderContentEncodingName, c_EncodingGzip);
+                SendHttpJsonResponse(hdl, m_protocolDocumentGzip);
+            }
+            else
+            {
+                SendHttpJsonResponse(hdl, m_protocolDocument);
             }
         }
-
-        json << " ]";
-
-        SendHttpJsonResponse(hdl, json.str());
     }
 
-    void Service::HandleProtocolRequest(connection_hdl hdl)
+    void Service::HandleVersionRequest(connection_hdl hdl)
     {
-        SendHttpJsonResponse(hdl, "{}");
+        SendHttpJsonResponse(hdl, m_versionDocument);
     }
 
-    void Service::HandleVersionRequest(connection_hdl hdl)
+    std::string Service::BuildVersionDocument()
     {
         std::ostringstream json;
         json << "{\n";
@@ -202,7 +371,43 @@ namespace JsDebug
         json << "}";
 
         // TODO: Can we get the version of ChakraCore?
-        SendHttpJsonResponse(hdl, json.str());
+        return json.str();
+    }
+
+    void Service::UpdateListDocument()
+    {
+        bool first = true;
+        std::ostringstream json;
+        json << "[";
+
+        for (const auto& handler : m_handlers)
+        {
+            if (first)
+            {
+                first = false;
+            }
+            else
+            {
+                json << ",";
+            }
+
+            // TODO: Tweak these values to be more accurate.
+            json << " {\n";
+            json << "  \"description\": \"ChakraCore instance\",\n";
+            json << "  \"devtoolsFrontendUrl\": " <<
+                "\"chrome-devtools://devtools/bundled/inspector.html?experiments=true&v8only=true&ws=localhost:" <<
+                m_port << "/" << handler.second->Id() << "\",\n";
+            json << "  \"id\": \"" << handler.second->Id() << "\",\n";
+            json << "  \"title\": \"ChakraCore instance\",\n";
+            json << "  \"type\": \"node\",\n";
+            json << "  \"url\": \"file://\",\n";
+            json << "  \"webSocketDebuggerUrl\": \"ws://localhost:" << m_port << "/" << handler.second->Id() << "\"\n";
+            json << "}";
+        }
+
+        json << " ]";
+
+        std::atomic_store(&m_listDocument, std::make_shared<const std::string>(json.str()));
     }
 
     void Service::SendHttpJsonResponse(connection_hdl hdl, const std::string& jsonBody)
@@ -216,4 +421,4 @@ namespace JsDebug
             connection->set_status(websocketpp::http::status_code::ok);
         }
     }
-}
\ No newline at end of file
+}
@@ -3,7 +3,11 @@
 
 #pragma once
 
+#include "InProcessConnection.h"
 #include "ServiceHandler.h"
+#include "WebSocketConnection.h"
+
+#include <vector>
 
 namespace JsDebug
 {
@@ -15,11 +19,21 @@ namespace JsDebug
 
         void RegisterHandler(const char* id, JsDebugProtocolHandler protocolHandler, bool breakOnNextLine);
         void UnregisterHandler(const char* id);
+        void GetHandlerStats(const char* id, JsDebugServiceHandlerStats* stats);
 
+        void SetThreadCount(uint32_t threadCount);
         void Listen(uint16_t port);
         void Close();
 
+        std::shared_ptr<InProcessConnection> ConnectClient(
+            const char* id,
+            JsDebugServiceClientMessageCallback callback,
+            void* callbackState);
+
     private:
+        void StartThreads();
+        bool ConnectHandler(const std::string& id, std::shared_ptr<ServiceConnection> connection);
+
         bool OnValidate(websocketpp::connection_hdl hdl);
         void OnHttpRequest(websocketpp::connection_hdl hdl);
 
@@ -29,15 +43,27 @@ namespace JsDebug
 
         void SendHttpJsonResponse(websocketpp::connection_hdl hdl, const std::string& jsonBody);
 
+        static std::string BuildVersionDocument();
+        void UpdateListDocument();
+
         typedef std::map<std::string, std::unique_ptr<ServiceHandler>> handler_map;
 
         // Although access to the server object is thread-safe, access to all other objects is not. The lock must be
-        // taken before accessing any class members from either thread.
-        websocketpp::server<websocketpp::config::asio> m_server;
-        websocketpp::lib::thread m_thread;
+        // taken before accessing any class members from any of the threads. Each connection runs its handlers on its
+        // own strand, so a connection is only ever serviced by one thread at a time.
+        ServiceServer m_server;
+        std::vector<websocketpp::lib::thread> m_threads;
         websocketpp::lib::mutex m_lock;
 
+        uint32_t m_threadCount;
         uint16_t m_port;
         handler_map m_handlers;
+
+        // Discovery endpoints are polled continuously, so their documents are built ahead of time. The target list is
+        // rebuilt under the lock whenever it changes and swapped in atomically, and requests only ever read it.
+        std::shared_ptr<const std::string> m_listDocument;
+        const std::string m_versionDocument;
+        const std::string m_protocolDocument;
+        const std::string m_protocolDocumentGzip;
     };
 }
@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <functional>
+
+namespace JsDebug
+{
+    // The asio transport connection, extended to report each completed write. This lets a connection that is holding
+    // messages back send them as soon as the socket drains. WebSocket++ has no handler for this, but the connection
+    // class derives from the transport connection and calls its async_write, so the call can be wrapped here.
+    template <typename config>
+    class ServiceTransportConnection : public websocketpp::transport::asio::connection<config>
+    {
+    public:
+        typedef websocketpp::transport::asio::connection<config> base;
+        typedef std::function<void()> write_complete_handler;
+
+        explicit ServiceTransportConnection(
+            bool is_server,
+            const websocketpp::lib::shared_ptr<typename config::alog_type>& alog,
+            const websocketpp::lib::shared_ptr<typename config::elog_type>& elog)
+            : base(is_server, alog, elog)
+        {
+        }
+
+        // Called on the connection's strand after each frame is written, once WebSocket++ has released the buffers.
+        void set_write_complete_handler(write_complete_handler handler)
+        {
+            m_writeCompleteHandler = handler;
+        }
+
+    protected:
+        using base::async_write;
+
+        void async_write(
+            const std::vector<websocketpp::transport::buffer>& bufs,
+            websocketpp::transport::write_handler handler)
+        {
+            auto writeCompleteHandler = m_writeCompleteHandler;
+            base::async_write(bufs, [handler, writeCompleteHandler](const websocketpp::lib::error_code& ec)
+            {
+                handler(ec);
+
+                if (!ec && writeCompleteHandler)
+                {
+                    writeCompleteHandler();
+                }
+            });
+        }
+
+    private:
+        write_complete_handler m_writeCompleteHandler;
+    };
+
+    template <typename config>
+    class ServiceTransport : public websocketpp::transport::asio::endpoint<config>
+    {
+    public:
+        typedef ServiceTransportConnection<config> transport_con_type;
+    };
+
+    // The default asio configuration using the transport above. If CHAKRA_DEBUGGER_ENABLE_DEFLATE is defined the
+    // permessage-deflate extension is enabled too. The extension is only used when the client offers it during the
+    // handshake, and it requires zlib to be available to the build.
+    struct ServiceConfig : public websocketpp::config::asio
+    {
+        typedef ServiceConfig type;
+        typedef websocketpp::config::asio base;
+
+        typedef base::concurrency_type concurrency_type;
+
+        typedef base::request_type request_type;
+        typedef base::response_type response_type;
+
+        typedef base::message_type message_type;
+        typedef base::con_msg_manager_type con_msg_manager_type;
+        typedef base::endpoint_msg_manager_type endpoint_msg_manager_type;
+
+        typedef base::alog_type alog_type;
+        typedef base::elog_type elog_type;
+
+        typedef base::rng_type rng_type;
+
+        struct transport_config : public base::transport_config
+        {
+            typedef type::concurrency_type concurrency_type;
+            typedef type::alog_type alog_type;
+            typedef type::elog_type elog_type;
+            typedef type::request_type request_type;
+            typedef type::response_type response_type;
+            typedef websocketpp::transport::asio::basic_socket::endpoint socket_type;
+        };
+
+        typedef ServiceTransport<transport_config> transport_type;
+
+#ifdef CHAKRA_DEBUGGER_ENABLE_DEFLATE
+        struct permessage_deflate_config
+        {
+        };
+
+        typedef websocketpp::extensions::permessage_deflate::enabled<permessage_deflate_config> permessage_deflate_type;
+#endif
+    };
+
+    typedef websocketpp::server<ServiceConfig> ServiceServer;
+}
@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <ChakraDebugService.h>
+
+namespace JsDebug
+{
+    class ServiceHandler;
+
+    // A debugger client attached to a handler, independent of the transport it arrived on.
+    class ServiceConnection
+    {
+    public:
+        virtual ~ServiceConnection()
+        {
+        }
+
+        // Routes incoming messages and the close notification to the given handler, or stops routing them if null.
+        virtual void SetHandler(ServiceHandler* handler) = 0;
+
+        // Can be called from any thread.
+        virtual void Send(const char* message) = 0;
+        virtual void GetStats(JsDebugServiceHandlerStats* stats) = 0;
+
+        // Starts closing the connection. The handler is notified once it's closed, unless it was detached first.
+        virtual void Close() = 0;
+    };
+}
@@ -6,27 +6,14 @@
 
 namespace JsDebug
 {
-    typedef websocketpp::server<websocketpp::config::asio> server;
-
-    using websocketpp::connection_hdl;
-
-    using websocketpp::lib::bind;
-    using websocketpp::lib::placeholders::_1;
-    using websocketpp::lib::placeholders::_2;
-
-    namespace
-    {
-        const char c_MessageServerShutdown[] = "Server shutting down...";
-    }
+    using websocketpp::lib::mutex;
+    using websocketpp::lib::unique_lock;
 
     ServiceHandler::ServiceHandler(
-        server* server,
         const char* id,
         JsDebugProtocolHandler protocolHandler,
         bool breakOnNextLine)
-        : m_connected(false)
-        , m_server(server)
-        , m_id(id)
+        : m_id(id)
         , m_protocolHandler(protocolHandler)
         , m_breakOnNextLine(breakOnNextLine)
     {
@@ -34,23 +21,20 @@ namespace JsDebug
 
     ServiceHandler::~ServiceHandler()
     {
-        try
+        std::shared_ptr<ServiceConnection> connection = GetConnection();
+
+        if (connection != nullptr)
         {
-            if (!m_hdl.expired())
+            try
             {
-                auto connection = m_server->get_con_from_hdl(m_hdl);
-                connection->set_message_handler(nullptr);
-                connection->set_close_handler(nullptr);
-                connection->close(websocketpp::close::status::going_away, c_MessageServerShutdown);
+                connection->SetHandler(nullptr);
+                connection->Close();
+            }
+            catch (...)
+            {
+                // Don't allow the exception to propagate.
             }
-        }
-        catch (...)
-        {
-            // Don't allow the exception to propagate.
-        }
 
-        if (m_connected)
-        {
             // Ignore any returned error codes
             JsErrorCode err = JsDebugProtocolHandlerDisconnect(m_protocolHandler);
             UNREFERENCED_PARAMETER(err);
@@ -58,14 +42,12 @@ namespace JsDebug
         }
     }
 
-    bool ServiceHandler::Connect(connection_hdl hdl)
+    bool ServiceHandler::Connect(std::shared_ptr<ServiceConnection> connection)
     {
-        if (m_hdl.expired())
-        {
-            auto connection = m_server->get_con_from_hdl(hdl);
-            connection->set_message_handler(bind(&ServiceHandler::OnMessage, this, _1, _2));
-            connection->set_close_handler(bind(&ServiceHandler::OnClose, this, _1));
+        unique_lock<mutex> lock(m_lock);
 
+        if (m_connection == nullptr)
+        {
             if (JsDebugProtocolHandlerConnect(
                 m_protocolHandler,
                 m_breakOnNextLine,
@@ -75,8 +57,8 @@ namespace JsDebug
                 return false;
             }
 
-            m_connected = true;
-            m_hdl = hdl;
+            m_connection = connection;
+            m_connection->SetHandler(this);
 
             return true;
         }
@@ -86,9 +68,11 @@ namespace JsDebug
 
     void ServiceHandler::Disconnect()
     {
-        if (!m_hdl.expired())
+        std::shared_ptr<ServiceConnection> connection = GetConnection();
+
+        if (connection != nullptr)
         {
-            m_server->close(m_hdl, websocketpp::close::status::going_away, c_MessageServerShutdown);
+            connection->Close();
         }
     }
 
@@ -103,32 +87,56 @@ namespace JsDebug
         serviceHandler->SendResponse(response);
     }
 
+    void ServiceHandler::GetStats(JsDebugServiceHandlerStats* stats)
+    {
+        std::shared_ptr<ServiceConnection> connection = GetConnection();
+
+        if (connection != nullptr)
+        {
+            connection->GetStats(stats);
+        }
+        else
+        {
+            *stats = JsDebugServiceHandlerStats();
+        }
+    }
+
     void ServiceHandler::SendResponse(const char* response)
     {
-        if (!m_hdl.expired())
+        std::shared_ptr<ServiceConnection> connection = GetConnection();
+
+        if (connection != nullptr)
         {
-            m_server->send(m_hdl, std::string(response), websocketpp::frame::opcode::text);
+            connection->Send(response);
         }
     }
 
-    void ServiceHandler::OnMessage(connection_hdl hdl, server::message_ptr msg)
+    std::shared_ptr<ServiceConnection> ServiceHandler::GetConnection()
+    {
+        unique_lock<mutex> lock(m_lock);
+        return m_connection;
+    }
+
+    void ServiceHandler::OnMessage(const char* message)
     {
         // Ignore any returned error codes
-        JsErrorCode err = JsDebugProtocolHandlerSendCommand(m_protocolHandler, msg->get_payload().c_str());
+        JsErrorCode err = JsDebugProtocolHandlerSendCommand(m_protocolHandler, message);
         UNREFERENCED_PARAMETER(err);
         assert(err == JsNoError);
     }
 
-    void ServiceHandler::OnClose(connection_hdl hdl)
+    void ServiceHandler::OnClose(ServiceConnection* connection)
     {
-        if (m_connected)
+        unique_lock<mutex> lock(m_lock);
+
+        if (m_connection.get() == connection)
         {
             // Ignore any returned error codes
             JsErrorCode err = JsDebugProtocolHandlerDisconnect(m_protocolHandler);
             UNREFERENCED_PARAMETER(err);
             assert(err == JsNoError);
 
-            m_connected = false;
+            m_connection.reset();
         }
     }
 }
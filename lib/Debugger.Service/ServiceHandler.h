@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include "ServiceConnection.h"
+
 #include <ChakraDebugProtocolHandler.h> 
 
 namespace JsDebug
@@ -11,30 +13,34 @@ namespace JsDebug
     {
     public:
         ServiceHandler(
-            websocketpp::server<websocketpp::config::asio>* server,
             const char* id,
             JsDebugProtocolHandler protocolHandler,
             bool breakOnNextLine);
         ~ServiceHandler();
 
-        bool Connect(websocketpp::connection_hdl hdl);
+        bool Connect(std::shared_ptr<ServiceConnection> connection);
         void Disconnect();
 
         std::string Id();
+        void GetStats(JsDebugServiceHandlerStats* stats);
+
+        // Called by the connected client's transport.
+        void OnMessage(const char* message);
+        void OnClose(ServiceConnection* connection);
 
     private:
         static void CHAKRA_CALLBACK SendResponseCallback(const char* response, void* callbackState);
         void SendResponse(const char* response);
 
-        void OnMessage(websocketpp::connection_hdl hdl, websocketpp::server<websocketpp::config::asio>::message_ptr msg);
-        void OnClose(websocketpp::connection_hdl hdl);
+        std::shared_ptr<ServiceConnection> GetConnection();
 
-        bool m_connected;
-        websocketpp::server<websocketpp::config::asio>* m_server;
+        // Connections for different handlers can be serviced on different threads, and responses are sent from the
+        // script thread, so the connection state is guarded by this lock.
+        websocketpp::lib::mutex m_lock;
         std::string m_id;
         JsDebugProtocolHandler m_protocolHandler;
         bool m_breakOnNextLine;
 
-        websocketpp::connection_hdl m_hdl;
+        std::shared_ptr<ServiceConnection> m_connection;
     };
 }
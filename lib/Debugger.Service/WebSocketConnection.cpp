@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+#include "WebSocketConnection.h"
+#include "ServiceHandler.h"
+
+#include <cstring>
+
+namespace JsDebug
+{
+    typedef ServiceServer server;
+
+    using websocketpp::connection_hdl;
+
+    using websocketpp::lib::mutex;
+    using websocketpp::lib::unique_lock;
+
+    namespace
+    {
+        const size_t c_HighWatermarkBytes = 4 * 1024 * 1024;
+        const size_t c_LowWatermarkBytes = 1024 * 1024;
+        const size_t c_MaxQueuedBytes = 64 * 1024 * 1024;
+        const char c_MessageServerShutdown[] = "Server shutting down...";
+        const char c_MessageClientStalled[] = "Client is not reading messages";
+
+        // Compressing small messages costs more time than it saves on the wire.
+        const size_t c_MinCompressedMessageBytes = 1024;
+    }
+
+    WebSocketConnection::WebSocketConnection(server* server, connection_hdl hdl)
+        : m_server(server)
+        , m_hdl(hdl)
+        , m_messages(c_LowWatermarkBytes, c_HighWatermarkBytes, c_MaxQueuedBytes)
+        , m_isOverflowed(false)
+        , m_sentCount(0)
+    {
+    }
+
+    void WebSocketConnection::SetHandler(ServiceHandler* handler)
+    {
+        websocketpp::lib::error_code ec;
+        auto connection = m_server->get_con_from_hdl(m_hdl, ec);
+        if (ec || connection == nullptr)
+        {
+            return;
+        }
+
+        if (handler != nullptr)
+        {
+            connection->set_message_handler([handler](connection_hdl, server::message_ptr msg)
+            {
+                handler->OnMessage(msg->get_payload().c_str());
+            });
+            connection->set_close_handler([handler, this](connection_hdl)
+            {
+                handler->OnClose(this);
+            });
+
+            // The transport connection outlives this object if the handler lets go of it first.
+            std::weak_ptr<WebSocketConnection> weak = shared_from_this();
+            connection->set_write_complete_handler([weak]()
+            {
+                auto self = weak.lock();
+                if (self != nullptr)
+                {
+                    self->OnWriteComplete();
+                }
+            });
+        }
+        else
+        {
+            connection->set_message_handler(nullptr);
+            connection->set_close_handler(nullptr);
+            connection->set_write_complete_handler(nullptr);
+        }
+    }
+
+    void WebSocketConnection::Send(const char* message)
+    {
+        unique_lock<mutex> lock(m_lock);
+
+        if (m_isOverflowed)
+        {
+            return;
+        }
+
+        size_t length = std::strlen(message);
+        switch (m_messages.Push(message, length, GetBufferedAmount()))
+        {
+        case OutboundQueue::PushResult::Send:
+            SendNow(message, length);
+            break;
+
+        case OutboundQueue::PushResult::Overflow:
+        {
+            m_isOverflowed = true;
+
+            websocketpp::lib::error_code ec;
+            m_server->close(m_hdl, websocketpp::close::status::try_again_later, c_MessageClientStalled, ec);
+            break;
+        }
+
+        default:
+            break;
+        }
+    }
+
+    void WebSocketConnection::GetStats(JsDebugServiceHandlerStats* stats)
+    {
+        unique_lock<mutex> lock(m_lock);
+
+        stats->queuedMessages = m_messages.GetQueuedMessages();
+        stats->queuedBytes = m_messages.GetQueuedBytes();
+        stats->peakQueuedBytes = m_messages.GetPeakQueuedBytes();
+        stats->bufferedBytes = GetBufferedAmount();
+        stats->sentMessages = m_sentCount;
+        stats->droppedMessages = m_messages.GetDroppedMessages();
+    }
+
+    void WebSocketConnection::Close()
+    {
+        websocketpp::lib::error_code ec;
+        m_server->close(m_hdl, websocketpp::close::status::going_away, c_MessageServerShutdown, ec);
+    }
+
+    void WebSocketConnection::OnWriteComplete()
+    {
+        unique_lock<mutex> lock(m_lock);
+        Drain();
+    }
+
+    void WebSocketConnection::Drain()
+    {
+        std::string message;
+        while (m_messages.TryPop(GetBufferedAmount(), message))
+        {
+            SendNow(message.c_str(), message.length());
+        }
+    }
+
+    void WebSocketConnection::SendNow(const char* message, size_t length)
+    {
+        websocketpp::lib::error_code ec;
+        auto connection = m_server->get_con_from_hdl(m_hdl, ec);
+        if (ec || connection == nullptr)
+        {
+            return;
+        }
+
+        auto msg = connection->get_message(websocketpp::frame::opcode::text, length);
+        msg->append_payload(message, length);
+
+        // This only has an effect if the client negotiated permessage-deflate.
+        msg->set_compressed(length >= c_MinCompressedMessageBytes);
+
+        connection->send(msg);
+        ++m_sentCount;
+    }
+
+    size_t WebSocketConnection::GetBufferedAmount()
+    {
+        websocketpp::lib::error_code ec;
+        auto connection = m_server->get_con_from_hdl(m_hdl, ec);
+
+        return (ec || connection == nullptr) ? 0 : connection->get_buffered_amount();
+    }
+}
@@ -0,0 +1,40 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "OutboundQueue.h"
+#include "ServiceConnection.h"
+
+namespace JsDebug
+{
+    // A client connected over TCP. Messages are sent without letting a slow client grow the socket buffer without
+    // bound, see OutboundQueue. Held back messages are sent as writes complete, and a client that stops reading
+    // altogether is disconnected.
+    class WebSocketConnection : public ServiceConnection, public std::enable_shared_from_this<WebSocketConnection>
+    {
+    public:
+        WebSocketConnection(ServiceServer* server, websocketpp::connection_hdl hdl);
+        WebSocketConnection(const WebSocketConnection&) = delete;
+        WebSocketConnection& operator=(const WebSocketConnection&) = delete;
+
+        void SetHandler(ServiceHandler* handler) override;
+        void Send(const char* message) override;
+        void GetStats(JsDebugServiceHandlerStats* stats) override;
+        void Close() override;
+
+    private:
+        void OnWriteComplete();
+        void Drain();
+        void SendNow(const char* message, size_t length);
+        size_t GetBufferedAmount();
+
+        websocketpp::lib::mutex m_lock;
+        ServiceServer* m_server;
+        websocketpp::connection_hdl m_hdl;
+
+        OutboundQueue m_messages;
+        bool m_isOverflowed;
+        uint64_t m_sentCount;
+    };
+}
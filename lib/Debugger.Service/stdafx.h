@@ -21,6 +21,9 @@
 #define _WEBSOCKETPP_CPP11_TYPE_TRAITS_
 #include <websocketpp/config/asio_no_tls.hpp>
 #include <websocketpp/server.hpp>
+#ifdef CHAKRA_DEBUGGER_ENABLE_DEFLATE
+#include <websocketpp/extensions/permessage_deflate/enabled.hpp>
+#endif
 #pragma warning( pop )
 
 #include <cstdint>
@@ -31,3 +34,5 @@
 
 #include <ChakraCore.h>
 #include <ChakraDebugProtocolHandler.h>
+
+#include "ServiceConfig.h"
@@ -9,6 +9,16 @@
 #include <ChakraDebugProtocolHandler.h>
 #include <ChakraCore.h>
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <poll.h>
+#endif
+
 class JsrtTestFixture
 {
 public:
@@ -104,6 +114,90 @@ void ValidateResponses(const std::vector<std::string>& expected, const std::vect
     }
 }
 
+// Checks the command wait handle the way a host's event loop would, without waiting.
+bool IsWaitHandleSignaled(JsDebugWaitHandle waitHandle)
+{
+#ifdef _WIN32
+    return WaitForSingleObject(waitHandle, 0) == WAIT_OBJECT_0;
+#else
+    pollfd fd = { waitHandle, POLLIN, 0 };
+    return poll(&fd, 1, 0) == 1 && (fd.revents & POLLIN) != 0;
+#endif
+}
+
+// A debugger session that handles each pause from a callback. Tests send the commands they need from the callbacks,
+// including the resume, and check the responses once the script has run.
+class PausedSession
+{
+public:
+    typedef void(*PausedCallback)(PausedSession& session, const std::string& notification);
+    typedef void(*ResponseCallback)(PausedSession& session, const std::string& response);
+
+    PausedSession(JsDebugProtocolHandler protocolHandler, PausedCallback onPaused, ResponseCallback onResponse = nullptr)
+        : protocolHandler(protocolHandler)
+        , onPaused(onPaused)
+        , onResponse(onResponse)
+    {
+    }
+
+    // Connects and enables the debugger, which is answered by the response with id 0.
+    void Connect()
+    {
+        REQUIRE(JsDebugProtocolHandlerConnect(this->protocolHandler, false, &PausedSession::OnMessage, this) == JsNoError);
+        this->SendCommand("{\"id\":0,\"method\":\"Debugger.enable\"}");
+        REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->protocolHandler) == JsNoError);
+    }
+
+    void Disconnect()
+    {
+        REQUIRE(JsDebugProtocolHandlerDisconnect(this->protocolHandler) == JsNoError);
+        REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->protocolHandler) == JsNoError);
+    }
+
+    void SendCommand(const std::string& command)
+    {
+        REQUIRE(JsDebugProtocolHandlerSendCommand(this->protocolHandler, command.c_str()) == JsNoError);
+    }
+
+    const std::vector<std::string>& GetResponses() const
+    {
+        return this->responses;
+    }
+
+    const std::vector<std::string>& GetPausedNotifications() const
+    {
+        return this->pausedNotifications;
+    }
+
+private:
+    static void CHAKRA_CALLBACK OnMessage(const char* message, void* callbackState)
+    {
+        auto session = static_cast<PausedSession*>(callbackState);
+        std::string text(message);
+
+        if (text.find("\"method\":\"Debugger.paused\"") != std::string::npos)
+        {
+            session->pausedNotifications.push_back(text);
+            session->onPaused(*session, text);
+        }
+        else if (text.compare(0, 6, "{\"id\":") == 0)
+        {
+            session->responses.push_back(text);
+
+            if (session->onResponse != nullptr)
+            {
+                session->onResponse(*session, text);
+            }
+        }
+    }
+
+    JsDebugProtocolHandler protocolHandler;
+    PausedCallback onPaused;
+    ResponseCallback onResponse;
+    std::vector<std::string> responses;
+    std::vector<std::string> pausedNotifications;
+};
+
 TEST_CASE_METHOD(JsrtTestFixture, "JsDebugProtocolHandler Create")
 {
     CHECK(JsDebugProtocolHandlerCreate(this->GetRuntime(), nullptr) == JsErrorInvalidArgument);
@@ -147,7 +241,7 @@ TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler SendMessage")
         "{\"error\":{\"code\":-32600,\"message\":\"Message must have integer 'id' property\"}}",
         "{\"error\":{\"code\":-32600,\"message\":\"Message must have string 'method' property\"},\"id\":0}",
         "{\"error\":{\"code\":-32601,\"message\":\"'Foo.bar' wasn't found\"},\"id\":1}",
-        "{\"id\":2,\"result\":{\"domains\":[{\"name\":\"Console\",\"version\":\"1.2\"},{\"name\":\"Debugger\",\"version\":\"1.2\"},{\"name\":\"Runtime\",\"version\":\"1.2\"}]}}",
+        "{\"id\":2,\"result\":{\"domains\":[{\"name\":\"Console\",\"version\":\"1.2\"},{\"name\":\"Debugger\",\"version\":\"1.2\"},{\"name\":\"Runtime\",\"version\":\"1.2\"},{\"name\":\"TimeTravel\",\"version\":\"1.2\"}]}}",
         "{\"method\":\"Debugger.scriptParsed\",\"params\":{\"scriptId\":\"1\",\"url\":\"test.js\",\"startLine\":0,\"startColumn\":0,\"endLine\":1,\"endColumn\":0,\"executionContextId\":0,\"hash\":\"\",\"isLiveEdit\":false,\"sourceMapURL\":\"\",\"hasSourceURL\":false}}",
         "{\"id\":3,\"result\":{}}",
         "{\"method\":\"Debugger.scriptParsed\",\"params\":{\"scriptId\":\"1\",\"url\":\"test.js\",\"startLine\":0,\"startColumn\":0,\"endLine\":1,\"endColumn\":0,\"executionContextId\":0,\"hash\":\"\",\"isLiveEdit\":false,\"sourceMapURL\":\"\",\"hasSourceURL\":false}}",
@@ -186,6 +280,295 @@ TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler SendMessage")
     REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
 }
 
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler Inspection Command Priority")
+{
+    std::vector<std::string> expectedResponses
+    {
+        "{\"error\":{\"code\":-32601,\"message\":\"'Foo.bar' wasn't found\"},\"id\":1}",
+        "{\"error\":{\"code\":-32000,\"message\":\"Debugger is not enabled\"},\"id\":2}",
+        "{\"error\":{\"code\":-32601,\"message\":\"'Foo.bar' wasn't found\"},\"id\":3}",
+        "{\"id\":0,\"result\":{\"result\":{\"type\":\"number\",\"value\":3,\"description\":\"3\"}}}",
+    };
+
+    std::vector<std::string> actualResponses;
+    auto callback = [](const char* response, void* callbackState)
+    {
+        auto responses = static_cast<std::vector<std::string>*>(callbackState);
+        responses->emplace_back(response);
+    };
+
+    // Inspection requests wait for everything else, which stays in order with the connect.
+    REQUIRE(JsDebugProtocolHandlerConnect(this->GetProtocolHandler(), false, callback, &actualResponses) == JsNoError);
+
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":0, \"method\" : \"Runtime.evaluate\",\"params\":{\"expression\":\"1 + 2\"}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":1,\"method\":\"Foo.bar\"}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":2,\"method\":\"Debugger.resume\"}") == JsNoError);
+
+    // Only the top-level method counts, not one that appears in the parameters.
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"params\":{\"method\":\"Runtime.evaluate\",\"list\":[\"}\"]},\"id\":3,\"method\":\"Foo.bar\"}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+
+    ValidateResponses(expectedResponses, actualResponses);
+
+    REQUIRE(JsDebugProtocolHandlerDisconnect(this->GetProtocolHandler()) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler Breakpoint Changes Before Resume")
+{
+    // Set a breakpoint in the loop and resume, then remove it and resume again. Each change has to be handled before
+    // the resume that follows it, so the script stops in the loop once.
+    PausedSession session(this->GetProtocolHandler(), [](PausedSession& session, const std::string& /*notification*/)
+    {
+        switch (session.GetPausedNotifications().size())
+        {
+        case 1:
+            session.SendCommand("{\"id\":1,\"method\":\"Debugger.setBreakpointByUrl\",\"params\":{\"lineNumber\":3,\"url\":\"test.js\"}}");
+            session.SendCommand("{\"id\":2,\"method\":\"Debugger.resume\"}");
+            break;
+
+        case 2:
+        {
+            const std::string idKey = "\"breakpointId\":\"";
+            const std::string& response = session.GetResponses()[1];
+            size_t start = response.find(idKey) + idKey.length();
+            std::string breakpointId = response.substr(start, response.find('"', start) - start);
+
+            session.SendCommand("{\"id\":3,\"method\":\"Debugger.removeBreakpoint\",\"params\":{\"breakpointId\":\"" + breakpointId + "\"}}");
+            session.SendCommand("{\"id\":4,\"method\":\"Debugger.resume\"}");
+            break;
+        }
+
+        default:
+            session.SendCommand("{\"id\":5,\"method\":\"Debugger.resume\"}");
+            break;
+        }
+    });
+
+    session.Connect();
+
+    JsValueRef result = JS_INVALID_REFERENCE;
+    REQUIRE(this->RunScript("test.js", "function main() {\n  debugger;\n  for (var i = 0; i < 2; i++) {\n    var x = i;\n  }\n}\nmain();", &result) == JsNoError);
+
+    const std::vector<std::string>& responses = session.GetResponses();
+    REQUIRE(responses.size() == 5);
+    REQUIRE(responses[1].find("{\"id\":1,\"result\":{\"breakpointId\":") == 0);
+    REQUIRE(responses[2] == "{\"id\":2,\"result\":{}}");
+    REQUIRE(responses[3] == "{\"id\":3,\"result\":{}}");
+    REQUIRE(responses[4] == "{\"id\":4,\"result\":{}}");
+
+    REQUIRE(session.GetPausedNotifications().size() == 2);
+
+    session.Disconnect();
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler Reconnect Drops Stale Commands")
+{
+    std::vector<std::string> expectedResponses
+    {
+        "{\"error\":{\"code\":-32601,\"message\":\"'Foo.bar' wasn't found\"},\"id\":1}",
+    };
+
+    std::vector<std::string> firstResponses;
+    std::vector<std::string> secondResponses;
+    auto callback = [](const char* response, void* callbackState)
+    {
+        auto responses = static_cast<std::vector<std::string>*>(callbackState);
+        responses->emplace_back(response);
+    };
+
+    // Nothing is processed until both clients have come and gone, so the first client's command is still queued when
+    // the second one connects.
+    REQUIRE(JsDebugProtocolHandlerConnect(this->GetProtocolHandler(), false, callback, &firstResponses) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":0,\"method\":\"Foo.bar\"}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerDisconnect(this->GetProtocolHandler()) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerConnect(this->GetProtocolHandler(), false, callback, &secondResponses) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":1,\"method\":\"Foo.bar\"}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+
+    REQUIRE(firstResponses.empty());
+    ValidateResponses(expectedResponses, secondResponses);
+
+    REQUIRE(JsDebugProtocolHandlerDisconnect(this->GetProtocolHandler()) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler WaitForDebugger Timeout")
+{
+    auto callback = [](const char* /*response*/, void* /*callbackState*/) {};
+
+    bool timedOut = false;
+    JsDebugWaitHandle waitHandle = {};
+
+    // Parameter validation
+    REQUIRE(JsDebugProtocolHandlerWaitForDebuggerWithTimeout(nullptr, 0, &timedOut) == JsErrorInvalidArgument);
+    REQUIRE(JsDebugProtocolHandlerWaitForDebuggerWithTimeout(this->GetProtocolHandler(), 0, nullptr) == JsErrorInvalidArgument);
+    REQUIRE(JsDebugProtocolHandlerGetCommandWaitHandle(nullptr, &waitHandle) == JsErrorInvalidArgument);
+    REQUIRE(JsDebugProtocolHandlerGetCommandWaitHandle(this->GetProtocolHandler(), nullptr) == JsErrorInvalidArgument);
+
+    REQUIRE(JsDebugProtocolHandlerGetCommandWaitHandle(this->GetProtocolHandler(), &waitHandle) == JsNoError);
+    REQUIRE(!IsWaitHandleSignaled(waitHandle));
+
+    REQUIRE(JsDebugProtocolHandlerConnect(this->GetProtocolHandler(), false, callback, nullptr) == JsNoError);
+    REQUIRE(IsWaitHandleSignaled(waitHandle));
+
+    REQUIRE(JsDebugProtocolHandlerWaitForDebuggerWithTimeout(this->GetProtocolHandler(), 10, &timedOut) == JsNoError);
+    REQUIRE(timedOut);
+    REQUIRE(!IsWaitHandleSignaled(waitHandle));
+
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":0,\"method\":\"Runtime.enable\"}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":1,\"method\":\"Runtime.runIfWaitingForDebugger\"}") == JsNoError);
+    REQUIRE(IsWaitHandleSignaled(waitHandle));
+
+    REQUIRE(JsDebugProtocolHandlerWaitForDebuggerWithTimeout(this->GetProtocolHandler(), 10000, &timedOut) == JsNoError);
+    REQUIRE(!timedOut);
+    REQUIRE(!IsWaitHandleSignaled(waitHandle));
+
+    REQUIRE(JsDebugProtocolHandlerDisconnect(this->GetProtocolHandler()) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler ProcessCommandQueue Budget")
+{
+    std::vector<std::string> expectedResponses
+    {
+        "{\"error\":{\"code\":-32601,\"message\":\"'Foo.bar' wasn't found\"},\"id\":0}",
+        "{\"error\":{\"code\":-32601,\"message\":\"'Foo.bar' wasn't found\"},\"id\":1}",
+        "{\"error\":{\"code\":-32601,\"message\":\"'Foo.bar' wasn't found\"},\"id\":2}",
+    };
+
+    std::vector<std::string> actualResponses;
+    auto callback = [](const char* response, void* callbackState)
+    {
+        auto responses = static_cast<std::vector<std::string>*>(callbackState);
+        responses->emplace_back(response);
+    };
+
+    size_t remaining = 0;
+
+    // Parameter validation
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueueWithBudget(nullptr, 1, 0, &remaining) == JsErrorInvalidArgument);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueueWithBudget(this->GetProtocolHandler(), 1, 0, nullptr) == JsErrorInvalidArgument);
+
+    REQUIRE(JsDebugProtocolHandlerConnect(this->GetProtocolHandler(), false, callback, &actualResponses) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":0,\"method\":\"Foo.bar\"}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":1,\"method\":\"Foo.bar\"}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":2,\"method\":\"Foo.bar\"}") == JsNoError);
+
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueueWithBudget(this->GetProtocolHandler(), 0, 1000, &remaining) == JsNoError);
+    REQUIRE(remaining == 4);
+    REQUIRE(actualResponses.empty());
+
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueueWithBudget(this->GetProtocolHandler(), 2, 1000, &remaining) == JsNoError);
+    REQUIRE(remaining == 2);
+    REQUIRE(actualResponses.size() == 1);
+
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueueWithBudget(this->GetProtocolHandler(), 10, 1000, &remaining) == JsNoError);
+    REQUIRE(remaining == 0);
+
+    ValidateResponses(expectedResponses, actualResponses);
+    actualResponses.clear();
+
+    // Inspection requests go last and count against the same budget.
+    std::vector<std::string> expectedResponses1
+    {
+        "{\"error\":{\"code\":-32000,\"message\":\"Debugger is not enabled\"},\"id\":4}",
+        "{\"id\":3,\"result\":{\"result\":{\"type\":\"number\",\"value\":3,\"description\":\"3\"}}}",
+    };
+
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":3,\"method\":\"Runtime.evaluate\",\"params\":{\"expression\":\"1 + 2\"}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":4,\"method\":\"Debugger.resume\"}") == JsNoError);
+
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueueWithBudget(this->GetProtocolHandler(), 1, 1000, &remaining) == JsNoError);
+    REQUIRE(remaining == 1);
+    REQUIRE(actualResponses.size() == 1);
+
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueueWithBudget(this->GetProtocolHandler(), 1, 1000, &remaining) == JsNoError);
+    REQUIRE(remaining == 0);
+
+    ValidateResponses(expectedResponses1, actualResponses);
+
+    REQUIRE(JsDebugProtocolHandlerDisconnect(this->GetProtocolHandler()) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler Async Break While Running")
+{
+    const int roundCount = 3;
+    const int commandsPerRound = 10;
+
+    std::atomic<int> responseCount(0);
+    auto callback = [](const char* /*response*/, void* callbackState)
+    {
+        ++*static_cast<std::atomic<int>*>(callbackState);
+    };
+
+    REQUIRE(JsDebugProtocolHandlerConnect(this->GetProtocolHandler(), false, callback, &responseCount) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+
+    // The script spins until the sender is done, so the commands can only be handled from the engine's async breaks.
+    std::atomic<bool> done(false);
+    auto isDone = [](JsValueRef /*callee*/, bool /*isConstructCall*/, JsValueRef* /*arguments*/,
+        unsigned short /*argumentCount*/, void* callbackState) -> JsValueRef
+    {
+        JsValueRef value = JS_INVALID_REFERENCE;
+        JsBoolToBoolean(*static_cast<std::atomic<bool>*>(callbackState), &value);
+        return value;
+    };
+
+    JsValueRef globalObject = JS_INVALID_REFERENCE;
+    REQUIRE(JsGetGlobalObject(&globalObject) == JsNoError);
+
+    JsValueRef isDoneFunction = JS_INVALID_REFERENCE;
+    REQUIRE(JsCreateFunction(isDone, &done, &isDoneFunction) == JsNoError);
+
+    JsPropertyIdRef isDonePropertyId = JS_INVALID_REFERENCE;
+    REQUIRE(JsGetPropertyIdFromName(L"isDone", &isDonePropertyId) == JsNoError);
+    REQUIRE(JsSetProperty(globalObject, isDonePropertyId, isDoneFunction, true) == JsNoError);
+
+    // Each round is a burst that shares one break. The next round only starts once that break has handled the burst,
+    // so it has to request a new one rather than rely on the break that already happened.
+    int handledRounds = 0;
+    std::thread sender([this, &responseCount, &done, &handledRounds]()
+    {
+        for (int round = 0; round < roundCount; ++round)
+        {
+            for (int i = 0; i < commandsPerRound; ++i)
+            {
+                std::string command =
+                    "{\"id\":" + std::to_string(round * commandsPerRound + i) + ",\"method\":\"Foo.bar\"}";
+                JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), command.c_str());
+            }
+
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (responseCount < (round + 1) * commandsPerRound && std::chrono::steady_clock::now() < deadline)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            if (responseCount < (round + 1) * commandsPerRound)
+            {
+                break;
+            }
+
+            ++handledRounds;
+        }
+
+        done = true;
+    });
+
+    JsValueRef result = JS_INVALID_REFERENCE;
+    JsErrorCode runResult = this->RunScript("spin.js", "while (!isDone()) {}", &result);
+    sender.join();
+
+    REQUIRE(runResult == JsNoError);
+    REQUIRE(handledRounds == roundCount);
+    REQUIRE(responseCount == roundCount * commandsPerRound);
+
+    REQUIRE(JsDebugProtocolHandlerDisconnect(this->GetProtocolHandler()) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+}
+
 TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler Connect BreakOnNextLine")
 {
     std::vector<std::string> expectedResponses
@@ -263,8 +646,8 @@ TEST_CASE_METHOD(JsrtDebugTestFixture, "CreateConsoleObject Runtime.enable")
         "{\"id\":0,\"result\":{}}",
         "{\"id\":1,\"result\":{}}",
         "{\"method\":\"Debugger.scriptParsed\",\"params\":{\"scriptId\":\"1\",\"url\":\"test.js\",\"startLine\":0,\"startColumn\":0,\"endLine\":1,\"endColumn\":0,\"executionContextId\":0,\"hash\":\"\",\"isLiveEdit\":false,\"sourceMapURL\":\"\",\"hasSourceURL\":false}}",
-        "{\"method\":\"Runtime.consoleAPICalled\",\"params\":{\"type\":\"log\",\"args\":[{\"type\":\"number\",\"description\":\"0\"}],\"executionContextId\":1,\"timestamp\":1}}",
-        "{\"method\":\"Runtime.consoleAPICalled\",\"params\":{\"type\":\"info\",\"args\":[{\"type\":\"string\",\"description\":\"this is info\"}],\"executionContextId\":1,\"timestamp\":2}}"
+        "{\"method\":\"Runtime.consoleAPICalled\",\"params\":{\"type\":\"log\",\"args\":[{\"type\":\"number\",\"value\":0,\"description\":\"0\"}],\"executionContextId\":1,\"timestamp\":1}}",
+        "{\"method\":\"Runtime.consoleAPICalled\",\"params\":{\"type\":\"info\",\"args\":[{\"type\":\"string\",\"value\":\"this is info\",\"description\":\"this is info\"}],\"executionContextId\":1,\"timestamp\":2}}"
     };
 
     std::vector<std::string> actualResponses;
@@ -334,18 +717,21 @@ TEST_CASE_METHOD(JsrtDebugTestFixture, "CreateConsoleObject without Runtime.enab
     REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":0,\"method\":\"Debugger.enable\"}") == JsNoError);
     this->AddConsoleObject();
 
-    // console APIs will not log anything as the Runtime is not enabled.
+    // console APIs will not send anything as the Runtime is not enabled, but the messages are kept.
     JsValueRef result = JS_INVALID_REFERENCE;
     REQUIRE(this->RunScript("test.js", "var i = 0; console.log(i); console.info('this is info');", &result) == JsNoError);
 
     ValidateResponses(expectedResponses, actualResponses);
     actualResponses.clear();
 
+    // The kept messages are sent when the Runtime is enabled, followed by the live ones.
     std::vector<std::string> expectedResponses1
     {
+        "{\"method\":\"Runtime.consoleAPICalled\",\"params\":{\"type\":\"log\",\"args\":[{\"type\":\"number\",\"value\":0,\"description\":\"0\"}],\"executionContextId\":1,\"timestamp\":1}}",
+        "{\"method\":\"Runtime.consoleAPICalled\",\"params\":{\"type\":\"info\",\"args\":[{\"type\":\"string\",\"value\":\"this is info\",\"description\":\"this is info\"}],\"executionContextId\":1,\"timestamp\":2}}",
         "{\"id\":0,\"result\":{}}",
         "{\"method\":\"Debugger.scriptParsed\",\"params\":{\"scriptId\":\"2\",\"url\":\"test.js\",\"startLine\":0,\"startColumn\":0,\"endLine\":1,\"endColumn\":0,\"executionContextId\":0,\"hash\":\"\",\"isLiveEdit\":false,\"sourceMapURL\":\"\",\"hasSourceURL\":false}}",
-        "{\"method\":\"Runtime.consoleAPICalled\",\"params\":{\"type\":\"log\",\"args\":[{\"type\":\"string\",\"description\":\"this is log\"}],\"executionContextId\":1,\"timestamp\":1}}"
+        "{\"method\":\"Runtime.consoleAPICalled\",\"params\":{\"type\":\"log\",\"args\":[{\"type\":\"string\",\"value\":\"this is log\",\"description\":\"this is log\"}],\"executionContextId\":1,\"timestamp\":3}}"
     };
 
     REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":0,\"method\":\"Runtime.enable\"}") == JsNoError);
@@ -353,6 +739,21 @@ TEST_CASE_METHOD(JsrtDebugTestFixture, "CreateConsoleObject without Runtime.enab
     REQUIRE(this->RunScript("test1.js", "console.log('this is log');", &result) == JsNoError);
 
     ValidateResponses(expectedResponses1, actualResponses);
+    actualResponses.clear();
+
+    // Nothing is sent again once the messages are discarded.
+    std::vector<std::string> expectedResponses2
+    {
+        "{\"id\":1,\"result\":{}}",
+        "{\"id\":2,\"result\":{}}",
+        "{\"id\":3,\"result\":{}}"
+    };
+
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":1,\"method\":\"Runtime.discardConsoleEntries\"}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":2,\"method\":\"Runtime.disable\"}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":3,\"method\":\"Runtime.enable\"}") == JsNoError);
+
+    ValidateResponses(expectedResponses2, actualResponses);
 
     REQUIRE(JsDebugProtocolHandlerSetCommandQueueCallback(this->GetProtocolHandler(), nullptr, nullptr) == JsNoError);
     REQUIRE(JsDebugProtocolHandlerDisconnect(this->GetProtocolHandler()) == JsNoError);
@@ -366,7 +767,11 @@ TEST_CASE_METHOD(JsrtDebugTestFixture, "CreateConsoleObject testing object visua
         "{\"id\":0,\"result\":{}}",
         "{\"id\":1,\"result\":{}}",
         "{\"method\":\"Debugger.scriptParsed\",\"params\":{\"scriptId\":\"1\",\"url\":\"test.js\",\"startLine\":0,\"startColumn\":0,\"endLine\":1,\"endColumn\":0,\"executionContextId\":0,\"hash\":\"\",\"isLiveEdit\":false,\"sourceMapURL\":\"\",\"hasSourceURL\":false}}",
-        "{\"method\":\"Runtime.consoleAPICalled\",\"params\":{\"type\":\"log\",\"args\":[{\"type\":\"object\",\"description\":\"{\\\"key_one\\\":\\\"value_one\\\",\\\"key_two\\\":{\\\"key_three\\\":3},\\\"key_four\\\":null}\"}],\"executionContextId\":1,\"timestamp\":1}}"
+        "{\"method\":\"Runtime.consoleAPICalled\",\"params\":{\"type\":\"log\",\"args\":[{\"type\":\"object\",\"description\":\"Object\",\"objectId\":\"{\\\"id\\\":1}\",\"preview\":{\"type\":\"object\",\"description\":\"Object\",\"overflow\":false,\"properties\":[{\"name\":\"key_one\",\"type\":\"string\",\"value\":\"value_one\"},{\"name\":\"key_two\",\"type\":\"object\",\"value\":\"Object\"},{\"name\":\"key_four\",\"type\":\"number\",\"value\":\"NaN\"}]}}],\"executionContextId\":1,\"timestamp\":1}}",
+        "{\"id\":2,\"result\":{\"result\":[{\"name\":\"key_one\",\"value\":{\"type\":\"string\",\"value\":\"value_one\",\"description\":\"value_one\"},\"writable\":true,\"configurable\":true,\"enumerable\":true,\"isOwn\":true},{\"name\":\"key_two\",\"value\":{\"type\":\"object\",\"description\":\"Object\",\"objectId\":\"{\\\"id\\\":2}\"},\"writable\":true,\"configurable\":true,\"enumerable\":true,\"isOwn\":true},{\"name\":\"key_four\",\"value\":{\"type\":\"number\",\"unserializableValue\":\"NaN\",\"description\":\"NaN\"},\"writable\":true,\"configurable\":true,\"enumerable\":true,\"isOwn\":true}]}}",
+        "{\"id\":3,\"result\":{}}",
+        "{\"method\":\"Runtime.consoleAPICalled\",\"params\":{\"type\":\"log\",\"args\":[{\"type\":\"object\",\"description\":\"Object\",\"preview\":{\"type\":\"object\",\"description\":\"Object\",\"overflow\":false,\"properties\":[{\"name\":\"key_one\",\"type\":\"string\",\"value\":\"value_one\"},{\"name\":\"key_two\",\"type\":\"object\",\"value\":\"Object\"},{\"name\":\"key_four\",\"type\":\"number\",\"value\":\"NaN\"}]}}],\"executionContextId\":1,\"timestamp\":1}}",
+        "{\"id\":4,\"result\":{}}"
     };
 
     std::vector<std::string> actualResponses;
@@ -397,9 +802,922 @@ TEST_CASE_METHOD(JsrtDebugTestFixture, "CreateConsoleObject testing object visua
     JsValueRef result = JS_INVALID_REFERENCE;
     REQUIRE(this->RunScript("test.js", "var obj = { key_one : \"value_one\", key_two : { key_three : 3 }, key_four : NaN }; console.log(obj);", &result) == JsNoError);
 
+    // Logged objects are only read further when they are expanded.
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":2,\"method\":\"Runtime.getProperties\",\"params\":{\"objectId\":\"{\\\"id\\\":1}\"}}") == JsNoError);
+
+    // The kept message reuses the arguments sent live, without the object ids that a later frontend can't use.
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":3,\"method\":\"Runtime.disable\"}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":4,\"method\":\"Runtime.enable\"}") == JsNoError);
+
     ValidateResponses(expectedResponses, actualResponses);
 
     REQUIRE(JsDebugProtocolHandlerSetCommandQueueCallback(this->GetProtocolHandler(), nullptr, nullptr) == JsNoError);
     REQUIRE(JsDebugProtocolHandlerDisconnect(this->GetProtocolHandler()) == JsNoError);
     REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
 }
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler AsyncTask")
+{
+    static int task = 0;
+
+    // Parameter validation
+    REQUIRE(JsDebugProtocolHandlerAsyncTaskScheduled(nullptr, &task, "task") == JsErrorInvalidArgument);
+    REQUIRE(JsDebugProtocolHandlerAsyncTaskStarted(nullptr, &task) == JsErrorInvalidArgument);
+    REQUIRE(JsDebugProtocolHandlerAsyncTaskFinished(nullptr, &task) == JsErrorInvalidArgument);
+
+    PausedSession session(this->GetProtocolHandler(), [](PausedSession& session, const std::string& /*notification*/)
+    {
+        session.SendCommand("{\"id\":2,\"method\":\"Debugger.resume\"}");
+    });
+
+    session.Connect();
+    session.SendCommand("{\"id\":1,\"method\":\"Debugger.setAsyncCallStackDepth\",\"params\":{\"maxDepth\":8}}");
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+
+    // Schedule the task from script, the way a host's setTimeout would, so that there is a stack to record.
+    auto scheduleTask = [](JsValueRef /*callee*/, bool /*isConstructCall*/, JsValueRef* /*arguments*/,
+        unsigned short /*argumentCount*/, void* callbackState) -> JsValueRef
+    {
+        REQUIRE(JsDebugProtocolHandlerAsyncTaskScheduled(
+            static_cast<JsDebugProtocolHandler>(callbackState), &task, "setTimeout") == JsNoError);
+
+        JsValueRef undefined = JS_INVALID_REFERENCE;
+        JsGetUndefinedValue(&undefined);
+        return undefined;
+    };
+
+    JsValueRef globalObject = JS_INVALID_REFERENCE;
+    REQUIRE(JsGetGlobalObject(&globalObject) == JsNoError);
+
+    JsValueRef scheduleFunction = JS_INVALID_REFERENCE;
+    REQUIRE(JsCreateFunction(scheduleTask, this->GetProtocolHandler(), &scheduleFunction) == JsNoError);
+
+    JsPropertyIdRef schedulePropertyId = JS_INVALID_REFERENCE;
+    REQUIRE(JsGetPropertyIdFromName(L"scheduleTask", &schedulePropertyId) == JsNoError);
+    REQUIRE(JsSetProperty(globalObject, schedulePropertyId, scheduleFunction, true) == JsNoError);
+
+    JsValueRef result = JS_INVALID_REFERENCE;
+    REQUIRE(this->RunScript("schedule.js", "function schedule() {\n    scheduleTask();\n}\nschedule();", &result) == JsNoError);
+
+    REQUIRE(JsDebugProtocolHandlerAsyncTaskStarted(this->GetProtocolHandler(), &task) == JsNoError);
+    REQUIRE(this->RunScript("task.js", "debugger;", &result) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerAsyncTaskFinished(this->GetProtocolHandler(), &task) == JsNoError);
+
+    const std::vector<std::string>& responses = session.GetResponses();
+    REQUIRE(responses.size() == 3);
+    REQUIRE(responses[1] == "{\"id\":1,\"result\":{}}");
+
+    // The pause inside the task reports where the task was scheduled from.
+    const std::vector<std::string>& notifications = session.GetPausedNotifications();
+    REQUIRE(notifications.size() == 1);
+
+    size_t asyncStackTrace = notifications[0].find("\"asyncStackTrace\":{\"description\":\"setTimeout\",\"callFrames\":[");
+    REQUIRE(asyncStackTrace != std::string::npos);
+
+    std::string frames = notifications[0].substr(asyncStackTrace);
+    REQUIRE(frames.find("{\"functionName\":\"schedule\",") != std::string::npos);
+    REQUIRE(frames.find("\"url\":\"schedule.js\",\"lineNumber\":1,\"columnNumber\":4}") != std::string::npos);
+    REQUIRE(frames.find("\"parent\":") == std::string::npos);
+
+    session.Disconnect();
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler SendCommand Contention", "[.][benchmark]")
+{
+    const int producerCount = 4;
+    const int commandsPerProducer = 50000;
+    const int totalCommands = producerCount * commandsPerProducer;
+
+    int responseCount = 0;
+    auto callback = [](const char* /*response*/, void* callbackState)
+    {
+        ++*static_cast<int*>(callbackState);
+    };
+
+    REQUIRE(JsDebugProtocolHandlerConnect(this->GetProtocolHandler(), false, callback, &responseCount) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+
+    std::atomic<bool> start(false);
+    std::vector<std::thread> producers;
+
+    for (int i = 0; i < producerCount; ++i)
+    {
+        producers.emplace_back([this, &start, i]()
+        {
+            while (!start)
+            {
+                std::this_thread::yield();
+            }
+
+            for (int j = 0; j < commandsPerProducer; ++j)
+            {
+                std::string command = "{\"id\":" + std::to_string(i * commandsPerProducer + j) + ",\"method\":\"Foo.bar\"}";
+                JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), command.c_str());
+            }
+        });
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    start = true;
+
+    while (responseCount < totalCommands)
+    {
+        REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    WARN(totalCommands << " commands from " << producerCount << " producers in " << elapsed.count() << "ms");
+    REQUIRE(responseCount == totalCommands);
+
+    REQUIRE(JsDebugProtocolHandlerDisconnect(this->GetProtocolHandler()) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler getProperties Wide Object", "[.][benchmark]")
+{
+    struct BenchmarkState
+    {
+        JsDebugProtocolHandler protocolHandler;
+        int requestCount;
+        int responseCount;
+        int errorCount;
+        std::chrono::steady_clock::time_point startTime;
+        std::chrono::steady_clock::time_point endTime;
+    };
+
+    BenchmarkState state { this->GetProtocolHandler(), 200, 0, 0 };
+
+    // Once paused, expand the global object repeatedly and then resume. Responses are counted from the enable
+    // response onwards, so the last expansion is response number requestCount + 1.
+    auto callback = [](const char* response, void* callbackState)
+    {
+        auto state = static_cast<BenchmarkState*>(callbackState);
+        std::string message(response);
+
+        if (message.find("\"method\":\"Debugger.paused\"") != std::string::npos)
+        {
+            state->startTime = std::chrono::steady_clock::now();
+
+            for (int i = 1; i <= state->requestCount; ++i)
+            {
+                std::string command = "{\"id\":" + std::to_string(i) + ",\"method\":\"Runtime.getProperties\","
+                    "\"params\":{\"objectId\":\"{\\\"ordinal\\\":0,\\\"name\\\":\\\"globals\\\"}\"}}";
+                JsDebugProtocolHandlerSendCommand(state->protocolHandler, command.c_str());
+            }
+
+            std::string resume = "{\"id\":" + std::to_string(state->requestCount + 1) + ",\"method\":\"Debugger.resume\"}";
+            JsDebugProtocolHandlerSendCommand(state->protocolHandler, resume.c_str());
+        }
+        else if (message.compare(0, 6, "{\"id\":") == 0)
+        {
+            if (message.find("\"error\":") != std::string::npos)
+            {
+                ++state->errorCount;
+            }
+
+            if (++state->responseCount == state->requestCount + 1)
+            {
+                state->endTime = std::chrono::steady_clock::now();
+            }
+        }
+    };
+
+    REQUIRE(JsDebugProtocolHandlerConnect(this->GetProtocolHandler(), false, callback, &state) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":0,\"method\":\"Debugger.enable\"}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+
+    JsValueRef result = JS_INVALID_REFERENCE;
+    REQUIRE(this->RunScript("wide.js", "for (var i = 0; i < 5000; i++) { this['p' + i] = i; } debugger;", &result) == JsNoError);
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(state.endTime - state.startTime);
+
+    WARN(state.requestCount << " expansions of a global object with 5000 properties in " << elapsed.count() << "ms");
+    REQUIRE(state.responseCount == state.requestCount + 2);
+    REQUIRE(state.errorCount == 0);
+
+    REQUIRE(JsDebugProtocolHandlerDisconnect(this->GetProtocolHandler()) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler evaluateOnCallFrame returnByValue")
+{
+    PausedSession session(this->GetProtocolHandler(), [](PausedSession& session, const std::string& /*notification*/)
+    {
+        session.SendCommand("{\"id\":1,\"method\":\"Debugger.evaluateOnCallFrame\","
+            "\"params\":{\"callFrameId\":\"{\\\"ordinal\\\":0}\",\"expression\":\"o\",\"returnByValue\":true}}");
+        session.SendCommand("{\"id\":2,\"method\":\"Debugger.evaluateOnCallFrame\","
+            "\"params\":{\"callFrameId\":\"{\\\"ordinal\\\":0}\",\"expression\":\"-1/0\",\"returnByValue\":true}}");
+        session.SendCommand("{\"id\":3,\"method\":\"Debugger.evaluateOnCallFrame\","
+            "\"params\":{\"callFrameId\":\"{\\\"ordinal\\\":0}\",\"expression\":\"t\",\"returnByValue\":true}}");
+        session.SendCommand("{\"id\":4,\"method\":\"Debugger.evaluateOnCallFrame\","
+            "\"params\":{\"callFrameId\":\"{\\\"ordinal\\\":0}\",\"expression\":\"p\",\"returnByValue\":true}}");
+        session.SendCommand("{\"id\":5,\"method\":\"Debugger.evaluateOnCallFrame\","
+            "\"params\":{\"callFrameId\":\"{\\\"ordinal\\\":0}\",\"expression\":\"big\",\"returnByValue\":true}}");
+    },
+    [](PausedSession& session, const std::string& response)
+    {
+        // Evaluations are held back behind other commands, so only resume once the last one is answered.
+        if (response.compare(0, 7, "{\"id\":5") == 0)
+        {
+            session.SendCommand("{\"id\":6,\"method\":\"Debugger.resume\"}");
+        }
+    });
+
+    session.Connect();
+
+    // Functions, accessors and non-enumerable properties are left out, and the cycle back to the object is cut. Typed
+    // arrays are keyed by index, and proxies are left out without running their traps.
+    JsValueRef result = JS_INVALID_REFERENCE;
+    REQUIRE(this->RunScript("value.js",
+        "var o = { a: 1, s: 'x', n: [1, undefined], f: function () {} }; o.self = o;"
+        "Object.defineProperty(o, 'g', { get: function () { throw 1; }, enumerable: true });"
+        "Object.defineProperty(o, 'h', { value: 2, enumerable: false });"
+        "var t = new Uint8Array([1, 2]);"
+        "var p = { a: 1, p: new Proxy({}, { ownKeys: function () { throw 1; } }) };"
+        "var big = new Float64Array(1000000); debugger;",
+        &result) == JsNoError);
+
+    // Values that were cut short are marked in their description.
+    const std::vector<std::string>& responses = session.GetResponses();
+    REQUIRE(responses.size() == 7);
+    REQUIRE(responses[1].find("\"value\":{\"a\":1,\"s\":\"x\",\"n\":[1,null],\"self\":null}") != std::string::npos);
+    REQUIRE(responses[1].find(" (truncated)\"") != std::string::npos);
+    REQUIRE(responses[2].find("\"unserializableValue\":\"-Infinity\"") != std::string::npos);
+    REQUIRE(responses[3].find("\"value\":{\"0\":1,\"1\":2}") != std::string::npos);
+    REQUIRE(responses[3].find(" (truncated)\"") == std::string::npos);
+    REQUIRE(responses[4].find("\"value\":{\"a\":1,\"p\":null}") != std::string::npos);
+    REQUIRE(responses[4].find(" (truncated)\"") != std::string::npos);
+
+    // A large typed array is only walked as far as the budget allows.
+    REQUIRE(responses[5].find("\"value\":{\"0\":0,\"1\":0,") != std::string::npos);
+    REQUIRE(responses[5].find("\"999999\":") == std::string::npos);
+    REQUIRE(responses[5].find(" (truncated)\"") != std::string::npos);
+
+    session.Disconnect();
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler evaluateExpressionsOnCallFrame")
+{
+    PausedSession session(this->GetProtocolHandler(), [](PausedSession& session, const std::string& /*notification*/)
+    {
+        session.SendCommand("{\"id\":1,\"method\":\"Debugger.evaluateExpressionsOnCallFrame\","
+            "\"params\":{\"callFrameId\":\"{\\\"ordinal\\\":0}\",\"expressions\":[\"a + 1\",\"a.b.c\",\"'x' + a\"]}}");
+        session.SendCommand("{\"id\":2,\"method\":\"Debugger.evaluateExpressionsOnCallFrame\","
+            "\"params\":{\"callFrameId\":\"{\\\"ordinal\\\":0}\",\"expressions\":[]}}");
+    },
+    [](PausedSession& session, const std::string& response)
+    {
+        if (response.compare(0, 7, "{\"id\":2") == 0)
+        {
+            session.SendCommand("{\"id\":3,\"method\":\"Debugger.resume\"}");
+        }
+    });
+
+    session.Connect();
+
+    JsValueRef result = JS_INVALID_REFERENCE;
+    REQUIRE(this->RunScript("watch.js", "var a = 1; debugger;", &result) == JsNoError);
+
+    // An expression that throws is reported in its own result, and the ones after it are still evaluated.
+    const std::vector<std::string>& responses = session.GetResponses();
+    REQUIRE(responses.size() == 4);
+    REQUIRE(responses[1].find("\"results\":[{\"result\":{\"type\":\"number\"") != std::string::npos);
+    REQUIRE(responses[1].find("\"value\":2") != std::string::npos);
+    REQUIRE(responses[1].find("\"exceptionDetails\":") != std::string::npos);
+    REQUIRE(responses[1].find("\"value\":\"x1\"") != std::string::npos);
+    REQUIRE(responses[2] == "{\"id\":2,\"result\":{\"results\":[]}}");
+
+    session.Disconnect();
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler getProperties generatePreview")
+{
+    // With previews, the locals of the paused frame can be shown from a single request.
+    PausedSession session(this->GetProtocolHandler(), [](PausedSession& session, const std::string& /*notification*/)
+    {
+        session.SendCommand("{\"id\":1,\"method\":\"Runtime.getProperties\","
+            "\"params\":{\"objectId\":\"{\\\"ordinal\\\":0,\\\"name\\\":\\\"locals\\\"}\",\"generatePreview\":true}}");
+    },
+    [](PausedSession& session, const std::string& response)
+    {
+        if (response.compare(0, 7, "{\"id\":1") == 0)
+        {
+            session.SendCommand("{\"id\":2,\"method\":\"Debugger.resume\"}");
+        }
+    });
+
+    session.Connect();
+
+    JsValueRef result = JS_INVALID_REFERENCE;
+    REQUIRE(this->RunScript("preview.js",
+        "(function () { var small = { a: 1, b: 2 }; var large = { a: 1, b: 2, c: 3, d: 4, e: 5, f: 6 }; debugger; })();",
+        &result) == JsNoError);
+
+    const std::vector<std::string>& responses = session.GetResponses();
+    REQUIRE(responses.size() == 3);
+    REQUIRE(responses[1].find("\"overflow\":false,\"properties\":["
+        "{\"name\":\"a\",\"type\":\"number\",\"value\":\"1\"},{\"name\":\"b\",\"type\":\"number\",\"value\":\"2\"}]")
+        != std::string::npos);
+    REQUIRE(responses[1].find("\"overflow\":true,\"properties\":[") != std::string::npos);
+
+    session.Disconnect();
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler setBlackboxPatterns")
+{
+    // Blackbox the library, then step into the call to it twice and resume.
+    PausedSession session(this->GetProtocolHandler(), [](PausedSession& session, const std::string& /*notification*/)
+    {
+        switch (session.GetPausedNotifications().size())
+        {
+        case 1:
+            session.SendCommand("{\"id\":1,\"method\":\"Debugger.setBlackboxPatterns\",\"params\":{\"patterns\":[\"(\"]}}");
+            session.SendCommand("{\"id\":2,\"method\":\"Debugger.setBlackboxPatterns\",\"params\":{\"patterns\":[\"^lib\"]}}");
+            session.SendCommand("{\"id\":3,\"method\":\"Debugger.stepInto\"}");
+            break;
+
+        case 2:
+            session.SendCommand("{\"id\":4,\"method\":\"Debugger.stepInto\"}");
+            break;
+
+        default:
+            session.SendCommand("{\"id\":5,\"method\":\"Debugger.resume\"}");
+            break;
+        }
+    });
+
+    session.Connect();
+
+    JsValueRef result = JS_INVALID_REFERENCE;
+    REQUIRE(this->RunScript("lib.js", "function lib() {\n  var x = 1;\n  var y = 2;\n  return x + y;\n}", &result) == JsNoError);
+    REQUIRE(this->RunScript("app.js", "function main() {\n  debugger;\n  lib();\n  var done = 1;\n}\nmain();", &result) == JsNoError);
+
+    // An invalid pattern is reported, and stepping into the library steps through it back to the caller.
+    const std::vector<std::string>& responses = session.GetResponses();
+    REQUIRE(responses.size() == 7);
+    REQUIRE(responses[1] == "{\"error\":{\"code\":-32000,\"message\":\"Invalid regular expression\"},\"id\":1}");
+    REQUIRE(responses[2] == "{\"id\":2,\"result\":{}}");
+
+    const std::vector<std::string>& notifications = session.GetPausedNotifications();
+    REQUIRE(notifications.size() == 3);
+    REQUIRE(notifications[2].find("\"functionName\":\"main\"") != std::string::npos);
+    REQUIRE(notifications[2].find("\"functionName\":\"lib\"") == std::string::npos);
+
+    session.Disconnect();
+}
+
+// Gets the location of the top call frame from a Debugger.paused notification.
+std::string GetTopFrameLocation(const std::string& notification)
+{
+    const std::string locationKey = "\"location\":";
+    size_t start = notification.find(locationKey) + locationKey.length();
+    return notification.substr(start, notification.find('}', start) + 1 - start);
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler setBlackboxPatterns Callback")
+{
+    // Blackbox the library, then step into a call to it that calls back into user code, and resume.
+    PausedSession session(this->GetProtocolHandler(), [](PausedSession& session, const std::string& /*notification*/)
+    {
+        switch (session.GetPausedNotifications().size())
+        {
+        case 1:
+            session.SendCommand("{\"id\":1,\"method\":\"Debugger.setBlackboxPatterns\",\"params\":{\"patterns\":[\"^lib\"]}}");
+            session.SendCommand("{\"id\":2,\"method\":\"Debugger.stepInto\"}");
+            break;
+
+        case 2:
+            session.SendCommand("{\"id\":3,\"method\":\"Debugger.stepInto\"}");
+            break;
+
+        default:
+            session.SendCommand("{\"id\":4,\"method\":\"Debugger.resume\"}");
+            break;
+        }
+    });
+
+    session.Connect();
+
+    JsValueRef result = JS_INVALID_REFERENCE;
+    REQUIRE(this->RunScript("lib.js", "function each(items, callback) {\n  for (var i = 0; i < items.length; i++) {\n    callback(items[i]);\n  }\n}", &result) == JsNoError);
+    REQUIRE(this->RunScript("app.js", "function main() {\n  debugger;\n  each([1], function visit(item) {\n    var seen = item;\n  });\n}\nmain();", &result) == JsNoError);
+
+    REQUIRE(session.GetResponses().size() == 5);
+
+    // The step passes through the library without stopping, but stops in the callback that it calls.
+    const std::vector<std::string>& notifications = session.GetPausedNotifications();
+    REQUIRE(notifications.size() == 3);
+    REQUIRE(notifications[2].find("\"functionName\":\"visit\"") < notifications[2].find("\"functionName\":\"each\""));
+    REQUIRE(GetTopFrameLocation(notifications[2]).find("\"lineNumber\":3,") != std::string::npos);
+
+    session.Disconnect();
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler stepUntil")
+{
+    // Stop after a number of steps, on entering a call, on leaving it, and at a location, then resume.
+    PausedSession session(this->GetProtocolHandler(), [](PausedSession& session, const std::string& notification)
+    {
+        std::string location = GetTopFrameLocation(notification);
+
+        switch (session.GetPausedNotifications().size())
+        {
+        case 1:
+            session.SendCommand("{\"id\":1,\"method\":\"Debugger.stepUntil\","
+                "\"params\":{\"stepType\":\"stepOver\",\"maxSteps\":0}}");
+            session.SendCommand("{\"id\":2,\"method\":\"Debugger.stepUntil\","
+                "\"params\":{\"stepType\":\"stepOver\",\"maxSteps\":2}}");
+            break;
+
+        case 2:
+            session.SendCommand("{\"id\":3,\"method\":\"Debugger.stepUntil\","
+                "\"params\":{\"stepType\":\"stepInto\",\"stopOnFrameDepthChange\":true}}");
+            break;
+
+        case 3:
+            session.SendCommand("{\"id\":4,\"method\":\"Debugger.stepUntil\","
+                "\"params\":{\"stepType\":\"stepOut\",\"stopOnFrameDepthChange\":true}}");
+            break;
+
+        case 4:
+            session.SendCommand("{\"id\":5,\"method\":\"Debugger.stepUntil\",\"params\":{\"stepType\":\"stepOver\","
+                "\"location\":" + location.substr(0, location.find(',')) + ",\"lineNumber\":9}}}");
+            break;
+
+        default:
+            session.SendCommand("{\"id\":6,\"method\":\"Debugger.resume\"}");
+            break;
+        }
+    });
+
+    session.Connect();
+
+    // Stepping into a call from main, or out of it, changes the frame depth. Stepping over the call doesn't.
+    JsValueRef result = JS_INVALID_REFERENCE;
+    REQUIRE(this->RunScript("stepUntil.js",
+        "function inner() {\n  var a = 1;\n  return a;\n}\n"
+        "function main() {\n  debugger;\n  var x = 1;\n  var y = inner();\n  var z = x + y;\n  return z;\n}\n"
+        "main();", &result) == JsNoError);
+
+    const std::vector<std::string>& responses = session.GetResponses();
+    REQUIRE(responses.size() == 7);
+    REQUIRE(responses[1] ==
+        "{\"error\":{\"code\":-32000,\"message\":\"Maximum number of steps must be positive\"},\"id\":1}");
+
+    const std::vector<std::string>& notifications = session.GetPausedNotifications();
+    REQUIRE(notifications.size() == 5);
+    REQUIRE(GetTopFrameLocation(notifications[1]).find("\"lineNumber\":7,") != std::string::npos);
+    REQUIRE(GetTopFrameLocation(notifications[2]).find("\"lineNumber\":1,") != std::string::npos);
+    REQUIRE(notifications[3].find("\"functionName\":\"main\"") != std::string::npos);
+    REQUIRE(notifications[3].find("\"functionName\":\"inner\"") == std::string::npos);
+    REQUIRE(GetTopFrameLocation(notifications[4]).find("\"lineNumber\":9,") != std::string::npos);
+
+    session.Disconnect();
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler continueToLocation")
+{
+    // Continue to a line that has a breakpoint, then to one that doesn't, then resume until the script ends.
+    PausedSession session(this->GetProtocolHandler(), [](PausedSession& session, const std::string& notification)
+    {
+        std::string location = GetTopFrameLocation(notification);
+        std::string scriptId = location.substr(0, location.find(','));
+        size_t count = session.GetPausedNotifications().size();
+
+        switch (count)
+        {
+        case 1:
+            session.SendCommand("{\"id\":1,\"method\":\"Debugger.setBreakpoint\","
+                "\"params\":{\"location\":" + scriptId + ",\"lineNumber\":2}}}");
+            session.SendCommand("{\"id\":2,\"method\":\"Debugger.continueToLocation\","
+                "\"params\":{\"location\":" + scriptId + ",\"lineNumber\":2}}}");
+            break;
+
+        case 2:
+            session.SendCommand("{\"id\":3,\"method\":\"Debugger.continueToLocation\","
+                "\"params\":{\"location\":" + scriptId + ",\"lineNumber\":3}}}");
+            break;
+
+        default:
+            session.SendCommand("{\"id\":" + std::to_string(count + 1) + ",\"method\":\"Debugger.resume\"}");
+            break;
+        }
+    });
+
+    session.Connect();
+
+    JsValueRef result = JS_INVALID_REFERENCE;
+    REQUIRE(this->RunScript("continueToLocation.js",
+        "function f(i) {\n  var a = i;\n  var b = a + 1;\n  return b;\n}\n"
+        "debugger;\n"
+        "for (var i = 0; i < 3; i++) { f(i); }", &result) == JsNoError);
+
+    const std::vector<std::string>& responses = session.GetResponses();
+    REQUIRE(responses.size() == 7);
+    REQUIRE(responses[2] == "{\"id\":2,\"result\":{}}");
+    REQUIRE(responses[3] == "{\"id\":3,\"result\":{}}");
+
+    // The breakpoint that was already at the first location is still hit on later calls, while the temporary one at
+    // the second location is gone once reached.
+    const std::vector<std::string>& notifications = session.GetPausedNotifications();
+    REQUIRE(notifications.size() == 5);
+    REQUIRE(GetTopFrameLocation(notifications[1]).find("\"lineNumber\":2,") != std::string::npos);
+    REQUIRE(GetTopFrameLocation(notifications[2]).find("\"lineNumber\":3,") != std::string::npos);
+    REQUIRE(GetTopFrameLocation(notifications[3]).find("\"lineNumber\":2,") != std::string::npos);
+    REQUIRE(GetTopFrameLocation(notifications[4]).find("\"lineNumber\":2,") != std::string::npos);
+
+    session.Disconnect();
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler getProperties Buckets")
+{
+    // Evaluate each array and expand the object returned for it. Then release the first bucket of the dense array,
+    // expand that bucket again and resume.
+    auto onPaused = [](PausedSession& session, const std::string& /*notification*/)
+    {
+        const char* expressions[] = { "dense", "sparse", "mixed" };
+
+        for (int i = 0; i < 3; ++i)
+        {
+            session.SendCommand("{\"id\":" + std::to_string(i + 1) + ",\"method\":\"Debugger.evaluateOnCallFrame\","
+                "\"params\":{\"callFrameId\":\"{\\\"ordinal\\\":0}\",\"expression\":\"" + expressions[i] + "\"}}");
+        }
+    };
+
+    auto onResponse = [](PausedSession& session, const std::string& response)
+    {
+        for (int i = 1; i <= 3; ++i)
+        {
+            std::string prefix = "{\"id\":" + std::to_string(i) + ",";
+            if (response.compare(0, prefix.length(), prefix) == 0)
+            {
+                const std::string objectIdKey = "\"objectId\":\"";
+                size_t start = response.find(objectIdKey) + objectIdKey.length();
+                std::string objectId = response.substr(start, response.find("}\"", start) + 1 - start);
+
+                session.SendCommand("{\"id\":" + std::to_string(i + 10) + ",\"method\":\"Runtime.getProperties\","
+                    "\"params\":{\"objectId\":\"" + objectId + "\"}}");
+            }
+        }
+
+        if (response.compare(0, 8, "{\"id\":13") == 0)
+        {
+            const std::string objectIdKey = "\"objectId\":\"";
+            const std::string& dense = session.GetResponses()[4];
+            size_t start = dense.find(objectIdKey, dense.find("\"name\":\"[0 ... 99]\"")) + objectIdKey.length();
+            std::string bucketId = dense.substr(start, dense.find("}\"", start) + 1 - start);
+
+            session.SendCommand("{\"id\":14,\"method\":\"Runtime.releaseObject\","
+                "\"params\":{\"objectId\":\"" + bucketId + "\"}}");
+            session.SendCommand("{\"id\":15,\"method\":\"Runtime.getProperties\","
+                "\"params\":{\"objectId\":\"" + bucketId + "\"}}");
+        }
+        else if (response.compare(0, 8, "{\"id\":15") == 0)
+        {
+            session.SendCommand("{\"id\":4,\"method\":\"Debugger.resume\"}");
+        }
+    };
+
+    PausedSession session(this->GetProtocolHandler(), onPaused, onResponse);
+    session.Connect();
+
+    JsValueRef result = JS_INVALID_REFERENCE;
+    REQUIRE(this->RunScript("buckets.js",
+        "var dense = []; for (var i = 0; i < 250; i++) { dense[i] = i; }"
+        "var sparse = []; for (var i = 0; i < 150; i++) { sparse[i * 1000] = i; }"
+        "var mixed = []; for (var i = 0; i < 150; i++) { mixed[i] = i; } mixed.x = 1; mixed.y = 2;"
+        "debugger;",
+        &result) == JsNoError);
+
+    // The responses to getProperties come after the evaluations and before the resume.
+    const std::vector<std::string>& responses = session.GetResponses();
+    REQUIRE(responses.size() == 10);
+
+    const std::string& dense = responses[4];
+    REQUIRE(dense.compare(0, 8, "{\"id\":11") == 0);
+    REQUIRE(dense.find("\"name\":\"[0 ... 99]\"") != std::string::npos);
+    REQUIRE(dense.find("\"name\":\"[100 ... 199]\"") != std::string::npos);
+    REQUIRE(dense.find("\"name\":\"[200 ... 249]\"") != std::string::npos);
+
+    // Labels show the indices in each bucket rather than its positions.
+    const std::string& sparse = responses[5];
+    REQUIRE(sparse.compare(0, 8, "{\"id\":12") == 0);
+    REQUIRE(sparse.find("\"name\":\"[0 ... 99000]\"") != std::string::npos);
+    REQUIRE(sparse.find("\"name\":\"[100000 ... 149000]\"") != std::string::npos);
+
+    // Named properties are listed on their own rather than inside a bucket.
+    const std::string& mixed = responses[6];
+    REQUIRE(mixed.compare(0, 8, "{\"id\":13") == 0);
+    REQUIRE(mixed.find("\"name\":\"[0 ... 99]\"") != std::string::npos);
+    REQUIRE(mixed.find("\"name\":\"[100 ... 149]\"") != std::string::npos);
+    REQUIRE(mixed.find("\"name\":\"x\"") != std::string::npos);
+    REQUIRE(mixed.find("\"name\":\"y\"") != std::string::npos);
+
+    // A bucket shares the handle of its array, so releasing it leaves the array and its other buckets usable.
+    REQUIRE(responses[7] == "{\"id\":14,\"result\":{}}");
+    REQUIRE(responses[8].compare(0, 8, "{\"id\":15") == 0);
+    REQUIRE(responses[8].find("\"error\":") == std::string::npos);
+    REQUIRE(responses[8].find("\"description\":\"99\"") != std::string::npos);
+
+    session.Disconnect();
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler releaseObjectGroup")
+{
+    // Expand an evaluated object and its child, release their group and try to use them again, then resume.
+    auto onPaused = [](PausedSession& session, const std::string& /*notification*/)
+    {
+        session.SendCommand("{\"id\":1,\"method\":\"Debugger.evaluateOnCallFrame\","
+            "\"params\":{\"callFrameId\":\"{\\\"ordinal\\\":0}\",\"expression\":\"o\",\"objectGroup\":\"watch\"}}");
+    };
+
+    auto onResponse = [](PausedSession& session, const std::string& response)
+    {
+        const std::string objectIdKey = "\"objectId\":\"";
+        auto getProperties = [](const std::string& objectId)
+        {
+            return "\"method\":\"Runtime.getProperties\",\"params\":{\"objectId\":\"" + objectId + "\"}}";
+        };
+        auto releaseObject = [](const std::string& objectId)
+        {
+            return "\"method\":\"Runtime.releaseObject\",\"params\":{\"objectId\":\"" + objectId + "\"}}";
+        };
+
+        // The child is read from the expansion of the object, which is the response with id 2.
+        auto getChildId = [&objectIdKey](const std::string& expanded)
+        {
+            size_t start = expanded.find(objectIdKey, expanded.find("\"name\":\"child\"")) + objectIdKey.length();
+            return expanded.substr(start, expanded.find("}\"", start) + 1 - start);
+        };
+
+        // Expansions are held back behind other commands, so each step waits for the answer to the one before.
+        if (response.compare(0, 7, "{\"id\":1") == 0)
+        {
+            size_t start = response.find(objectIdKey) + objectIdKey.length();
+            std::string objectId = response.substr(start, response.find("}\"", start) + 1 - start);
+
+            session.SendCommand("{\"id\":2," + getProperties(objectId));
+        }
+        else if (response.compare(0, 7, "{\"id\":2") == 0)
+        {
+            session.SendCommand("{\"id\":3," + getProperties(getChildId(response)));
+        }
+        else if (response.compare(0, 7, "{\"id\":3") == 0)
+        {
+            session.SendCommand("{\"id\":4,\"method\":\"Runtime.releaseObjectGroup\","
+                "\"params\":{\"objectGroup\":\"watch\"}}");
+        }
+        else if (response.compare(0, 7, "{\"id\":4") == 0)
+        {
+            session.SendCommand("{\"id\":5," + getProperties(getChildId(session.GetResponses()[2])));
+        }
+        else if (response.compare(0, 7, "{\"id\":5") == 0)
+        {
+            session.SendCommand("{\"id\":6," + releaseObject(getChildId(session.GetResponses()[2])));
+            session.SendCommand("{\"id\":7," + releaseObject("{\\\"handle\\\":99999}"));
+            session.SendCommand("{\"id\":8,\"method\":\"Debugger.resume\"}");
+        }
+    };
+
+    PausedSession session(this->GetProtocolHandler(), onPaused, onResponse);
+    session.Connect();
+
+    JsValueRef result = JS_INVALID_REFERENCE;
+    REQUIRE(this->RunScript("group.js", "var o = { a: 1, child: { b: 2 } }; debugger;", &result) == JsNoError);
+
+    // The child was expanded from an object in the group, so it is released along with it.
+    const std::vector<std::string>& responses = session.GetResponses();
+    REQUIRE(responses.size() == 9);
+    REQUIRE(responses[2].find("\"name\":\"a\"") != std::string::npos);
+    REQUIRE(responses[3].find("\"name\":\"b\"") != std::string::npos);
+    REQUIRE(responses[4] == "{\"id\":4,\"result\":{}}");
+    REQUIRE(responses[5].find("\"error\":") != std::string::npos);
+
+    // Releasing a handle that isn't in any group is reported.
+    REQUIRE(responses[6] == "{\"error\":{\"code\":-32000,\"message\":\"Invalid object ID\"},\"id\":6}");
+    REQUIRE(responses[7] == "{\"error\":{\"code\":-32000,\"message\":\"Invalid object ID\"},\"id\":7}");
+
+    session.Disconnect();
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler TimeTravel")
+{
+    // Parameter validation
+    REQUIRE(JsDebugProtocolHandlerSetTimeTravelReplay(nullptr, true) == JsErrorInvalidArgument);
+
+    // This runtime isn't replaying a log, so stepping backwards is rejected rather than stepping forwards.
+    PausedSession session(this->GetProtocolHandler(), [](PausedSession& session, const std::string& /*notification*/)
+    {
+        session.SendCommand("{\"id\":1,\"method\":\"TimeTravel.stepBack\"}");
+        session.SendCommand("{\"id\":2,\"method\":\"TimeTravel.reverse\"}");
+        session.SendCommand("{\"id\":3,\"method\":\"TimeTravel.writeTTDLog\",\"params\":{\"uri\":\"\"}}");
+        session.SendCommand("{\"id\":4,\"method\":\"Debugger.resume\"}");
+    });
+
+    session.Connect();
+
+    JsValueRef result = JS_INVALID_REFERENCE;
+    REQUIRE(this->RunScript("ttd.js", "debugger;", &result) == JsNoError);
+
+    // Once replaying, the commands still require a pause.
+    REQUIRE(JsDebugProtocolHandlerSetTimeTravelReplay(this->GetProtocolHandler(), true) == JsNoError);
+    session.SendCommand("{\"id\":5,\"method\":\"TimeTravel.stepBack\"}");
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+
+    const std::vector<std::string>& responses = session.GetResponses();
+    REQUIRE(responses.size() == 7);
+    REQUIRE(responses[1].find("\"message\":\"Can only step backwards while replaying a time-travel log\"") != std::string::npos);
+    REQUIRE(responses[2].find("\"message\":\"Can only step backwards while replaying a time-travel log\"") != std::string::npos);
+    REQUIRE(responses[3].find("\"message\":\"A non-empty uri must be specified\"") != std::string::npos);
+    REQUIRE(responses[4] == "{\"id\":4,\"result\":{}}");
+    REQUIRE(responses[5].find("\"message\":\"Can only perform operation while paused\"") != std::string::npos);
+
+    session.Disconnect();
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler Runtime.evaluate")
+{
+    std::vector<std::string> expectedResponses
+    {
+        "{\"id\":0,\"result\":{\"result\":{\"type\":\"number\",\"value\":3,\"description\":\"3\"}}}",
+        "{\"id\":1,\"result\":{\"scriptId\":\"compiled:2\"}}",
+        "{\"id\":2,\"result\":{\"result\":{\"type\":\"number\",\"value\":42,\"description\":\"42\"}}}",
+        "{\"id\":3,\"result\":{\"result\":{\"type\":\"number\",\"value\":42,\"description\":\"42\"}}}",
+        "{\"id\":4,\"result\":{\"scriptId\":\"compiled:2\"}}",
+        "{\"error\":{\"code\":-32000,\"message\":\"No script with given id\"},\"id\":5}",
+        "{\"error\":{\"code\":-32000,\"message\":\"Cannot find context with specified id\"},\"id\":6}",
+    };
+
+    std::vector<std::string> actualResponses;
+    auto callback = [](const char* response, void* callbackState)
+    {
+        auto responses = static_cast<std::vector<std::string>*>(callbackState);
+        responses->emplace_back(response);
+    };
+
+    REQUIRE(JsDebugProtocolHandlerConnect(this->GetProtocolHandler(), false, callback, &actualResponses) == JsNoError);
+
+    // Scripts compiled again with the same source come from the cache and keep their ID.
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":0,\"method\":\"Runtime.evaluate\",\"params\":{\"expression\":\"1 + 2\"}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":1,\"method\":\"Runtime.compileScript\",\"params\":{\"expression\":\"40 + 2\",\"sourceURL\":\"\",\"persistScript\":true}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":2,\"method\":\"Runtime.runScript\",\"params\":{\"scriptId\":\"compiled:2\"}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":3,\"method\":\"Runtime.evaluate\",\"params\":{\"expression\":\"40 + 2\"}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":4,\"method\":\"Runtime.compileScript\",\"params\":{\"expression\":\"40 + 2\",\"sourceURL\":\"\",\"persistScript\":true}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":5,\"method\":\"Runtime.runScript\",\"params\":{\"scriptId\":\"compiled:9\"}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":6,\"method\":\"Runtime.evaluate\",\"params\":{\"expression\":\"1\",\"contextId\":9}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+
+    ValidateResponses(expectedResponses, actualResponses);
+
+    REQUIRE(JsDebugProtocolHandlerDisconnect(this->GetProtocolHandler()) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler Runtime.compileScript Cache Cleared")
+{
+    std::vector<std::string> expectedResponses
+    {
+        "{\"id\":0,\"result\":{\"scriptId\":\"compiled:1\"}}",
+        "{\"id\":1,\"result\":{}}",
+        "{\"error\":{\"code\":-32000,\"message\":\"No script with given id\"},\"id\":2}",
+        "{\"id\":3,\"result\":{\"scriptId\":\"compiled:2\"}}",
+        "{\"error\":{\"code\":-32000,\"message\":\"No script with given id\"},\"id\":4}",
+    };
+
+    std::vector<std::string> actualResponses;
+    auto callback = [](const char* response, void* callbackState)
+    {
+        auto responses = static_cast<std::vector<std::string>*>(callbackState);
+        responses->emplace_back(response);
+    };
+
+    REQUIRE(JsDebugProtocolHandlerConnect(this->GetProtocolHandler(), false, callback, &actualResponses) == JsNoError);
+
+    // Runtime.disable drops the compiled scripts.
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":0,\"method\":\"Runtime.compileScript\",\"params\":{\"expression\":\"40 + 2\",\"sourceURL\":\"\",\"persistScript\":true}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":1,\"method\":\"Runtime.disable\"}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":2,\"method\":\"Runtime.runScript\",\"params\":{\"scriptId\":\"compiled:1\"}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":3,\"method\":\"Runtime.compileScript\",\"params\":{\"expression\":\"40 + 2\",\"sourceURL\":\"\",\"persistScript\":true}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+
+    // So does processing commands from a different host context.
+    JsContextRef otherContext = JS_INVALID_REFERENCE;
+    REQUIRE(JsCreateContext(this->GetRuntime(), &otherContext) == JsNoError);
+    REQUIRE(JsSetCurrentContext(otherContext) == JsNoError);
+
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":4,\"method\":\"Runtime.runScript\",\"params\":{\"scriptId\":\"compiled:2\"}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+
+    REQUIRE(JsSetCurrentContext(this->GetContext()) == JsNoError);
+
+    ValidateResponses(expectedResponses, actualResponses);
+
+    REQUIRE(JsDebugProtocolHandlerDisconnect(this->GetProtocolHandler()) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler Runtime.evaluate descriptions and previews")
+{
+    std::vector<std::string> actualResponses;
+    auto callback = [](const char* response, void* callbackState)
+    {
+        auto responses = static_cast<std::vector<std::string>*>(callbackState);
+        responses->emplace_back(response);
+    };
+
+    REQUIRE(JsDebugProtocolHandlerConnect(this->GetProtocolHandler(), false, callback, &actualResponses) == JsNoError);
+
+    // Objects are described without running their toString.
+    const char* expressions[] =
+    {
+        "new Uint8Array(4)",
+        "new Float64Array(3)",
+        "new ArrayBuffer(8)",
+        "new DataView(new ArrayBuffer(2))",
+        "(function foo() { })",
+        "new TypeError('bad')",
+        "var e = new Error('bad'); e.toString = function () { throw 1; }; e",
+    };
+
+    int id = 0;
+    for (const char* expression : expressions)
+    {
+        std::string command = "{\"id\":" + std::to_string(id++) +
+            ",\"method\":\"Runtime.evaluate\",\"params\":{\"expression\":\"" + expression + "\"}}";
+        REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), command.c_str()) == JsNoError);
+    }
+
+    // Previews stop at the first few names, and leave out inherited properties.
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":7,\"method\":\"Runtime.evaluate\",\"params\":{\"expression\":\"({ a: 1, b: 2, c: 3, d: 4, e: 5, f: 6 })\",\"generatePreview\":true}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":8,\"method\":\"Runtime.evaluate\",\"params\":{\"expression\":\"var o = Object.create({ inherited: 1 }); o.own = 2; o\",\"generatePreview\":true}}") == JsNoError);
+
+    // Array previews run no getters and don't look up holes on the prototype, and proxies are previewed without
+    // running their traps.
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":9,\"method\":\"Runtime.evaluate\",\"params\":{\"expression\":\"Array.prototype[1] = 'x'; var a = [1, , 3]; Object.defineProperty(a, 0, { get: function () { throw 1; } }); a\",\"generatePreview\":true}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":10,\"method\":\"Runtime.evaluate\",\"params\":{\"expression\":\"new Proxy({ a: 1 }, { ownKeys: function () { throw 1; }, getOwnPropertyDescriptor: function () { throw 1; } })\",\"generatePreview\":true}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+
+    REQUIRE(actualResponses.size() == 11);
+    REQUIRE(actualResponses[0].find("\"subtype\":\"typedarray\",\"description\":\"Uint8Array(4)\"") != std::string::npos);
+    REQUIRE(actualResponses[1].find("\"description\":\"Float64Array(3)\"") != std::string::npos);
+    REQUIRE(actualResponses[2].find("\"subtype\":\"arraybuffer\",\"description\":\"ArrayBuffer(8)\"") != std::string::npos);
+    REQUIRE(actualResponses[3].find("\"subtype\":\"dataview\",\"description\":\"DataView(2)\"") != std::string::npos);
+    REQUIRE(actualResponses[4].find("\"type\":\"function\",\"description\":\"function foo()\"") != std::string::npos);
+    REQUIRE(actualResponses[5].find("\"subtype\":\"error\",\"description\":\"TypeError: bad\"") != std::string::npos);
+    REQUIRE(actualResponses[6].find("\"subtype\":\"error\",\"description\":\"Error: bad\"") != std::string::npos);
+    REQUIRE(actualResponses[7].find("\"overflow\":true,\"properties\":["
+        "{\"name\":\"a\",\"type\":\"number\",\"value\":\"1\"},{\"name\":\"b\",\"type\":\"number\",\"value\":\"2\"},"
+        "{\"name\":\"c\",\"type\":\"number\",\"value\":\"3\"},{\"name\":\"d\",\"type\":\"number\",\"value\":\"4\"},"
+        "{\"name\":\"e\",\"type\":\"number\",\"value\":\"5\"}]") != std::string::npos);
+    REQUIRE(actualResponses[8].find("\"overflow\":false,\"properties\":["
+        "{\"name\":\"own\",\"type\":\"number\",\"value\":\"2\"}]") != std::string::npos);
+    REQUIRE(actualResponses[9].find("\"overflow\":false,\"properties\":["
+        "{\"name\":\"0\",\"type\":\"accessor\"},{\"name\":\"1\",\"type\":\"undefined\",\"value\":\"undefined\"},"
+        "{\"name\":\"2\",\"type\":\"number\",\"value\":\"3\"}]") != std::string::npos);
+    REQUIRE(actualResponses[10].find("\"overflow\":false,\"properties\":[]") != std::string::npos);
+
+    REQUIRE(JsDebugProtocolHandlerDisconnect(this->GetProtocolHandler()) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+}
+
+TEST_CASE_METHOD(JsrtDebugTestFixture, "JsDebugProtocolHandler Runtime.callFunctionOn")
+{
+    std::vector<std::string> expectedResponses
+    {
+        "{\"id\":0,\"result\":{\"result\":{\"type\":\"object\",\"description\":\"Object\",\"objectId\":\"{\\\"id\\\":1}\"}}}",
+        "{\"id\":1,\"result\":{\"result\":{\"type\":\"number\",\"value\":13,\"description\":\"13\"}}}",
+        "{\"id\":2,\"result\":{\"result\":{\"type\":\"boolean\",\"value\":true,\"description\":\"true\"}}}",
+        "{\"id\":3,\"result\":{\"result\":{\"type\":\"object\",\"value\":{\"b\":[1,2,3]},\"description\":\"Object\"}}}",
+        "{\"id\":4,\"result\":{}}",
+        "{\"error\":{\"code\":-32000,\"message\":\"Invalid object ID\"},\"id\":5}",
+    };
+
+    std::vector<std::string> actualResponses;
+    auto callback = [](const char* response, void* callbackState)
+    {
+        auto responses = static_cast<std::vector<std::string>*>(callbackState);
+        responses->emplace_back(response);
+    };
+
+    REQUIRE(JsDebugProtocolHandlerConnect(this->GetProtocolHandler(), false, callback, &actualResponses) == JsNoError);
+
+    // Arguments may be plain values or other objects, and the target is released along with its group.
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":0,\"method\":\"Runtime.evaluate\",\"params\":{\"expression\":\"({ a: { b: [1, 2, 3] } })\",\"objectGroup\":\"probe\"}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":1,\"method\":\"Runtime.callFunctionOn\",\"params\":{\"objectId\":\"{\\\"id\\\":1}\",\"functionDeclaration\":\"function (n) { return this.a.b.length + n; }\",\"arguments\":[{\"value\":10}]}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":2,\"method\":\"Runtime.callFunctionOn\",\"params\":{\"objectId\":\"{\\\"id\\\":1}\",\"functionDeclaration\":\"function (o) { return this === o; }\",\"arguments\":[{\"objectId\":\"{\\\"id\\\":1}\"}]}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":3,\"method\":\"Runtime.callFunctionOn\",\"params\":{\"objectId\":\"{\\\"id\\\":1}\",\"functionDeclaration\":\"function () { return this.a; }\",\"returnByValue\":true}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":4,\"method\":\"Runtime.releaseObjectGroup\",\"params\":{\"objectGroup\":\"probe\"}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerSendCommand(this->GetProtocolHandler(), "{\"id\":5,\"method\":\"Runtime.callFunctionOn\",\"params\":{\"objectId\":\"{\\\"id\\\":1}\",\"functionDeclaration\":\"function () { return this.a; }\"}}") == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+
+    ValidateResponses(expectedResponses, actualResponses);
+
+    REQUIRE(JsDebugProtocolHandlerDisconnect(this->GetProtocolHandler()) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+}
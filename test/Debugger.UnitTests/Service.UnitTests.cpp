@@ -0,0 +1,586 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+// Winsock has to come before anything that pulls in windows.h.
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+#include <catch.hpp>
+
+#include <ChakraDebugService.h>
+#include <OutboundQueue.h>
+
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using JsDebug::OutboundQueue;
+
+namespace
+{
+    const char c_Response[] = "{\"id\":1,\"result\":{}}";
+    const char c_ConsoleMessage[] = "{\"method\":\"Runtime.consoleAPICalled\",\"params\":{}}";
+    const char c_HttpStatusOk[] = "HTTP/1.1 200 OK\r\n";
+    const char c_HttpStatusSwitchingProtocols[] = "HTTP/1.1 101 Switching Protocols\r\n";
+
+    OutboundQueue::PushResult Push(OutboundQueue& queue, const char* message, size_t bufferedAmount)
+    {
+        return queue.Push(message, std::strlen(message), bufferedAmount);
+    }
+
+#ifdef _WIN32
+    typedef SOCKET SocketHandle;
+    const SocketHandle c_InvalidSocket = INVALID_SOCKET;
+#else
+    typedef int SocketHandle;
+    const SocketHandle c_InvalidSocket = -1;
+#endif
+
+    // A blocking client socket for talking to a listening service. Reads give up after a few seconds so that a
+    // service that never answers fails the test instead of hanging it.
+    class TestSocket
+    {
+    public:
+        TestSocket()
+            : socketHandle(c_InvalidSocket)
+        {
+#ifdef _WIN32
+            WSADATA data;
+            WSAStartup(MAKEWORD(2, 2), &data);
+#endif
+        }
+
+        ~TestSocket()
+        {
+            if (this->socketHandle != c_InvalidSocket)
+            {
+#ifdef _WIN32
+                closesocket(this->socketHandle);
+#else
+                close(this->socketHandle);
+#endif
+            }
+
+#ifdef _WIN32
+            WSACleanup();
+#endif
+        }
+
+        TestSocket(const TestSocket&) = delete;
+        TestSocket& operator=(const TestSocket&) = delete;
+
+        bool Connect(uint16_t port)
+        {
+            this->socketHandle = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+            if (this->socketHandle == c_InvalidSocket)
+            {
+                return false;
+            }
+
+#ifdef _WIN32
+            DWORD timeout = 10000;
+#else
+            timeval timeout = { 10, 0 };
+#endif
+            setsockopt(this->socketHandle, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&timeout),
+                sizeof(timeout));
+
+            sockaddr_in address = {};
+            address.sin_family = AF_INET;
+            address.sin_port = htons(port);
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+            return connect(this->socketHandle, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+        }
+
+        bool Send(const std::string& data)
+        {
+            size_t sent = 0;
+            while (sent < data.length())
+            {
+                int result = send(this->socketHandle, data.data() + sent, static_cast<int>(data.length() - sent), 0);
+                if (result <= 0)
+                {
+                    return false;
+                }
+
+                sent += result;
+            }
+
+            return true;
+        }
+
+        // Reads everything up to and including the delimiter.
+        bool ReadUntil(const std::string& delimiter, std::string& data)
+        {
+            size_t end = std::string::npos;
+            while ((end = this->buffer.find(delimiter)) == std::string::npos)
+            {
+                if (!this->Receive())
+                {
+                    return false;
+                }
+            }
+
+            return this->Read(end + delimiter.length(), data);
+        }
+
+        bool Read(size_t length, std::string& data)
+        {
+            while (this->buffer.length() < length)
+            {
+                if (!this->Receive())
+                {
+                    return false;
+                }
+            }
+
+            data = this->buffer.substr(0, length);
+            this->buffer.erase(0, length);
+            return true;
+        }
+
+        // Reads until the other end closes the connection.
+        std::string ReadToEnd()
+        {
+            while (this->Receive())
+            {
+            }
+
+            std::string data;
+            data.swap(this->buffer);
+            return data;
+        }
+
+    private:
+        bool Receive()
+        {
+            char chunk[4096];
+            int result = recv(this->socketHandle, chunk, sizeof(chunk), 0);
+            if (result <= 0)
+            {
+                return false;
+            }
+
+            this->buffer.append(chunk, result);
+            return true;
+        }
+
+        SocketHandle socketHandle;
+        std::string buffer;
+    };
+
+    // Sends a GET request and returns the whole response, headers included.
+    std::string HttpGet(uint16_t port, const std::string& resource, const std::string& headers = std::string())
+    {
+        TestSocket client;
+        if (!client.Connect(port) ||
+            !client.Send("GET " + resource + " HTTP/1.1\r\nHost: localhost\r\n" + headers + "\r\n"))
+        {
+            return std::string();
+        }
+
+        return client.ReadToEnd();
+    }
+
+    std::string GetHttpBody(const std::string& response)
+    {
+        size_t start = response.find("\r\n\r\n");
+        return start == std::string::npos ? std::string() : response.substr(start + 4);
+    }
+
+    bool HasHttpHeader(const std::string& response, const std::string& header)
+    {
+        size_t end = response.find("\r\n\r\n");
+        size_t found = response.find("\r\n" + header + "\r\n");
+        return found != std::string::npos && found < end;
+    }
+
+    // Sends a text frame, masked as every frame from a client has to be.
+    bool SendTextFrame(TestSocket& client, const std::string& payload)
+    {
+        const unsigned char mask[] = { 0x12, 0x34, 0x56, 0x78 };
+
+        std::string frame;
+        frame += static_cast<char>(0x81);
+
+        if (payload.length() < 126)
+        {
+            frame += static_cast<char>(0x80 | payload.length());
+        }
+        else
+        {
+            frame += static_cast<char>(0x80 | 126);
+            frame += static_cast<char>(payload.length() >> 8);
+            frame += static_cast<char>(payload.length() & 0xff);
+        }
+
+        frame.append(reinterpret_cast<const char*>(mask), sizeof(mask));
+
+        for (size_t i = 0; i < payload.length(); ++i)
+        {
+            frame += static_cast<char>(payload[i] ^ mask[i % sizeof(mask)]);
+        }
+
+        return client.Send(frame);
+    }
+
+    // Reads a single unfragmented frame from the service. The payload is left as is if it was compressed.
+    bool ReadFrame(TestSocket& client, std::string& payload, bool& isCompressed)
+    {
+        std::string header;
+        if (!client.Read(2, header))
+        {
+            return false;
+        }
+
+        isCompressed = (header[0] & 0x40) != 0;
+
+        size_t length = header[1] & 0x7f;
+        size_t extendedLength = length == 126 ? 2 : length == 127 ? 8 : 0;
+
+        if (extendedLength > 0)
+        {
+            std::string bytes;
+            if (!client.Read(extendedLength, bytes))
+            {
+                return false;
+            }
+
+            length = 0;
+            for (char byte : bytes)
+            {
+                length = (length << 8) | static_cast<unsigned char>(byte);
+            }
+        }
+
+        return client.Read(length, payload);
+    }
+}
+
+// A service with a single handler registered as "test", for a runtime that isn't running any script.
+class ServiceTestFixture
+{
+public:
+    ServiceTestFixture()
+        : runtime(nullptr)
+        , context(JS_INVALID_REFERENCE)
+        , protocolHandler(nullptr)
+        , service(nullptr)
+    {
+        REQUIRE(JsCreateRuntime(JsRuntimeAttributeNone, nullptr, &this->runtime) == JsNoError);
+        REQUIRE(JsCreateContext(this->runtime, &this->context) == JsNoError);
+        REQUIRE(JsAddRef(this->context, nullptr) == JsNoError);
+        REQUIRE(JsSetCurrentContext(this->context) == JsNoError);
+
+        REQUIRE(JsDebugProtocolHandlerCreate(this->runtime, &this->protocolHandler) == JsNoError);
+        REQUIRE(JsDebugServiceCreate(&this->service) == JsNoError);
+        REQUIRE(JsDebugServiceRegisterHandler(this->service, "test", this->protocolHandler, false) == JsNoError);
+    }
+
+    ~ServiceTestFixture()
+    {
+        REQUIRE(JsDebugServiceUnregisterHandler(this->service, "test") == JsNoError);
+        REQUIRE(JsDebugServiceDestroy(this->service) == JsNoError);
+        REQUIRE(JsDebugProtocolHandlerDestroy(this->protocolHandler) == JsNoError);
+
+        REQUIRE(JsSetCurrentContext(nullptr) == JsNoError);
+        REQUIRE(JsRelease(this->context, nullptr) == JsNoError);
+        REQUIRE(JsDisposeRuntime(this->runtime) == JsNoError);
+    }
+
+    JsDebugProtocolHandler GetProtocolHandler()
+    {
+        return this->protocolHandler;
+    }
+
+    JsDebugService GetService()
+    {
+        return this->service;
+    }
+
+private:
+    JsRuntimeHandle runtime;
+    JsContextRef context;
+    JsDebugProtocolHandler protocolHandler;
+    JsDebugService service;
+};
+
+TEST_CASE("OutboundQueue Watermarks")
+{
+    OutboundQueue queue(100, 1000, 10000);
+    std::string message;
+
+    // Under the high watermark messages go straight through.
+    CHECK(Push(queue, c_Response, 999) == OutboundQueue::PushResult::Send);
+    CHECK(Push(queue, c_ConsoleMessage, 0) == OutboundQueue::PushResult::Send);
+
+    // Once reached, responses are held back and console messages are dropped.
+    CHECK(Push(queue, c_Response, 1000) == OutboundQueue::PushResult::Queued);
+    CHECK(Push(queue, c_ConsoleMessage, 0) == OutboundQueue::PushResult::Dropped);
+    CHECK(Push(queue, c_Response, 0) == OutboundQueue::PushResult::Queued);
+    CHECK(queue.GetQueuedMessages() == 2);
+    CHECK(queue.GetQueuedBytes() == 2 * std::strlen(c_Response));
+    CHECK(queue.GetDroppedMessages() == 1);
+
+    // Nothing is released until the buffered amount falls under the low watermark.
+    CHECK_FALSE(queue.TryPop(500, message));
+    CHECK(queue.TryPop(99, message));
+    CHECK(message == c_Response);
+
+    // Draining stops again at the high watermark, and needs the low watermark to restart.
+    CHECK_FALSE(queue.TryPop(1000, message));
+    CHECK_FALSE(queue.TryPop(500, message));
+    CHECK(queue.TryPop(0, message));
+    CHECK(message == c_Response);
+
+    // Once empty, messages go straight through again.
+    CHECK_FALSE(queue.TryPop(0, message));
+    CHECK(queue.GetQueuedMessages() == 0);
+    CHECK(Push(queue, c_ConsoleMessage, 0) == OutboundQueue::PushResult::Send);
+    CHECK(queue.GetPeakQueuedBytes() == 2 * std::strlen(c_Response));
+}
+
+TEST_CASE("OutboundQueue Overflow")
+{
+    OutboundQueue queue(100, 1000, 3 * std::strlen(c_Response));
+    std::string message;
+
+    CHECK(Push(queue, c_Response, 1000) == OutboundQueue::PushResult::Queued);
+    CHECK(Push(queue, c_Response, 1000) == OutboundQueue::PushResult::Queued);
+    CHECK(Push(queue, c_Response, 1000) == OutboundQueue::PushResult::Queued);
+
+    // The message that would exceed the limit discards everything held back.
+    CHECK(Push(queue, c_Response, 1000) == OutboundQueue::PushResult::Overflow);
+    CHECK(queue.GetQueuedMessages() == 0);
+    CHECK(queue.GetQueuedBytes() == 0);
+    CHECK(queue.GetDroppedMessages() == 4);
+    CHECK_FALSE(queue.TryPop(0, message));
+}
+
+TEST_CASE_METHOD(ServiceTestFixture, "JsDebugService ConnectClient")
+{
+    std::vector<std::string> messages;
+    auto callback = [](const char* message, void* callbackState)
+    {
+        auto messages = static_cast<std::vector<std::string>*>(callbackState);
+        messages->emplace_back(message);
+    };
+
+    // Parameter validation
+    JsDebugServiceClient client = nullptr;
+    CHECK(JsDebugServiceConnectClient(this->GetService(), "missing", callback, &messages, &client) ==
+        JsErrorInvalidArgument);
+    CHECK(JsDebugServiceConnectClient(this->GetService(), "test", nullptr, &messages, &client) ==
+        JsErrorInvalidArgument);
+    CHECK(JsDebugServiceClientSendCommand(nullptr, "{}") == JsErrorInvalidArgument);
+    CHECK(JsDebugServiceDisconnectClient(nullptr) == JsErrorInvalidArgument);
+
+    REQUIRE(JsDebugServiceConnectClient(this->GetService(), "test", callback, &messages, &client) == JsNoError);
+
+    // The client takes the place of a remote debugger, so only one can be connected at a time.
+    JsDebugServiceClient other = nullptr;
+    CHECK(JsDebugServiceConnectClient(this->GetService(), "test", callback, &messages, &other) != JsNoError);
+
+    // Responses are delivered once the script thread processes the command.
+    REQUIRE(JsDebugServiceClientSendCommand(client,
+        "{\"id\":1,\"method\":\"Runtime.evaluate\",\"params\":{\"expression\":\"1 + 2\"}}") == JsNoError);
+    CHECK(messages.empty());
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+
+    REQUIRE(messages.size() == 1);
+    CHECK(messages[0] ==
+        "{\"id\":1,\"result\":{\"result\":{\"type\":\"number\",\"value\":3,\"description\":\"3\"}}}");
+
+    JsDebugServiceHandlerStats stats;
+    REQUIRE(JsDebugServiceGetHandlerStats(this->GetService(), "test", &stats) == JsNoError);
+    CHECK(stats.sentMessages == 1);
+    CHECK(stats.queuedMessages == 0);
+    CHECK(stats.droppedMessages == 0);
+
+    // Once the client disconnects, another one can take its place.
+    REQUIRE(JsDebugServiceDisconnectClient(client) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+
+    REQUIRE(JsDebugServiceConnectClient(this->GetService(), "test", callback, &messages, &client) == JsNoError);
+    REQUIRE(JsDebugServiceDisconnectClient(client) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+}
+
+TEST_CASE_METHOD(ServiceTestFixture, "JsDebugService SetThreadCount")
+{
+    const uint16_t port = 9339;
+    const int clientCount = 4;
+    const int requestsPerClient = 10;
+
+    // Parameter validation
+    CHECK(JsDebugServiceSetThreadCount(nullptr, 4) == JsErrorInvalidArgument);
+    CHECK(JsDebugServiceSetThreadCount(this->GetService(), 0) == JsErrorInvalidArgument);
+
+    REQUIRE(JsDebugServiceSetThreadCount(this->GetService(), 4) == JsNoError);
+    REQUIRE(JsDebugServiceListen(this->GetService(), port) == JsNoError);
+
+    // The pool is started by Listen, so it can't be resized after that.
+    CHECK(JsDebugServiceSetThreadCount(this->GetService(), 2) != JsNoError);
+
+    // Requests from several clients at once are all answered.
+    std::atomic<int> answered(0);
+    std::vector<std::thread> clients;
+
+    for (int i = 0; i < clientCount; ++i)
+    {
+        clients.emplace_back([&answered]()
+        {
+            for (int j = 0; j < requestsPerClient; ++j)
+            {
+                if (HttpGet(port, "/json/version").compare(0, std::strlen(c_HttpStatusOk), c_HttpStatusOk) == 0)
+                {
+                    ++answered;
+                }
+            }
+        });
+    }
+
+    for (auto& client : clients)
+    {
+        client.join();
+    }
+
+    CHECK(answered == clientCount * requestsPerClient);
+
+    // Once closed, the pool can be resized for the next Listen.
+    REQUIRE(JsDebugServiceClose(this->GetService()) == JsNoError);
+    CHECK(JsDebugServiceSetThreadCount(this->GetService(), 2) == JsNoError);
+}
+
+TEST_CASE_METHOD(ServiceTestFixture, "JsDebugService permessage-deflate")
+{
+    const uint16_t port = 9340;
+
+    REQUIRE(JsDebugServiceListen(this->GetService(), port) == JsNoError);
+
+    {
+        TestSocket client;
+        REQUIRE(client.Connect(port));
+        REQUIRE(client.Send(
+            "GET /test HTTP/1.1\r\n"
+            "Host: localhost\r\n"
+            "Upgrade: websocket\r\n"
+            "Connection: Upgrade\r\n"
+            "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+            "Sec-WebSocket-Version: 13\r\n"
+            "Sec-WebSocket-Extensions: permessage-deflate\r\n"
+            "\r\n"));
+
+        std::string handshake;
+        REQUIRE(client.ReadUntil("\r\n\r\n", handshake));
+        REQUIRE(handshake.compare(0, std::strlen(c_HttpStatusSwitchingProtocols), c_HttpStatusSwitchingProtocols) == 0);
+
+#ifdef CHAKRA_DEBUGGER_ENABLE_DEFLATE
+        CHECK(handshake.find("Sec-WebSocket-Extensions: permessage-deflate") != std::string::npos);
+#else
+        // Without the extension the offer is declined, and every message has to go out uncompressed.
+        CHECK(handshake.find("Sec-WebSocket-Extensions") == std::string::npos);
+#endif
+
+        // One response well over the compression threshold, and one well under it.
+        REQUIRE(SendTextFrame(client,
+            "{\"id\":1,\"method\":\"Runtime.evaluate\",\"params\":{\"expression\":\"'x'.repeat(4096)\"}}"));
+        REQUIRE(SendTextFrame(client, "{\"id\":2,\"method\":\"Runtime.runIfWaitingForDebugger\"}"));
+
+        bool timedOut = false;
+        REQUIRE(JsDebugProtocolHandlerWaitForDebuggerWithTimeout(this->GetProtocolHandler(), 10000, &timedOut) ==
+            JsNoError);
+        REQUIRE_FALSE(timedOut);
+
+        std::string payload;
+        bool isCompressed = false;
+
+        REQUIRE(ReadFrame(client, payload, isCompressed));
+#ifdef CHAKRA_DEBUGGER_ENABLE_DEFLATE
+        CHECK(isCompressed);
+#else
+        CHECK_FALSE(isCompressed);
+        CHECK(payload.compare(0, 8, "{\"id\":1,") == 0);
+        CHECK(payload.find(std::string(4096, 'x')) != std::string::npos);
+#endif
+
+        REQUIRE(ReadFrame(client, payload, isCompressed));
+        CHECK_FALSE(isCompressed);
+        CHECK(payload == "{\"id\":2,\"result\":{}}");
+    }
+
+    REQUIRE(JsDebugServiceClose(this->GetService()) == JsNoError);
+    REQUIRE(JsDebugProtocolHandlerProcessCommandQueue(this->GetProtocolHandler()) == JsNoError);
+}
+
+TEST_CASE_METHOD(ServiceTestFixture, "JsDebugService Discovery Documents")
+{
+    const uint16_t port = 9341;
+
+    REQUIRE(JsDebugServiceListen(this->GetService(), port) == JsNoError);
+
+    // The list names each registered handler and where to connect to it, and follows registrations.
+    std::string response = HttpGet(port, "/json/list");
+    REQUIRE(response.compare(0, std::strlen(c_HttpStatusOk), c_HttpStatusOk) == 0);
+    CHECK(HasHttpHeader(response, "Content-Type: application/json; charset=UTF-8"));
+    CHECK(GetHttpBody(response).find("\"id\": \"test\"") != std::string::npos);
+    CHECK(GetHttpBody(response).find("\"webSocketDebuggerUrl\": \"ws://localhost:9341/test\"") != std::string::npos);
+
+    REQUIRE(JsDebugServiceRegisterHandler(this->GetService(), "other", this->GetProtocolHandler(), false) ==
+        JsNoError);
+    CHECK(GetHttpBody(HttpGet(port, "/json")).find("\"id\": \"other\"") != std::string::npos);
+
+    REQUIRE(JsDebugServiceUnregisterHandler(this->GetService(), "other") == JsNoError);
+    CHECK(GetHttpBody(HttpGet(port, "/json/list")).find("\"id\": \"other\"") == std::string::npos);
+
+    response = HttpGet(port, "/json/version");
+    REQUIRE(response.compare(0, std::strlen(c_HttpStatusOk), c_HttpStatusOk) == 0);
+    CHECK(GetHttpBody(response).find("\"Protocol-Version\": \"1.2\"") != std::string::npos);
+
+    // The protocol document is sent compressed only to clients that accept it, and says so either way.
+    response = HttpGet(port, "/json/protocol");
+    REQUIRE(response.compare(0, std::strlen(c_HttpStatusOk), c_HttpStatusOk) == 0);
+    CHECK(HasHttpHeader(response, "Vary: Accept-Encoding"));
+    CHECK_FALSE(HasHttpHeader(response, "Content-Encoding: gzip"));
+
+    std::string body = GetHttpBody(response);
+    CHECK(body.compare(0, 1, "{") == 0);
+    CHECK(body.find("\"domain\": \"Debugger\"") != std::string::npos);
+
+    response = HttpGet(port, "/json/protocol", "Accept-Encoding: gzip, deflate\r\n");
+    REQUIRE(response.compare(0, std::strlen(c_HttpStatusOk), c_HttpStatusOk) == 0);
+    CHECK(HasHttpHeader(response, "Vary: Accept-Encoding"));
+    CHECK(HasHttpHeader(response, "Content-Encoding: gzip"));
+
+    std::string compressedBody = GetHttpBody(response);
+    REQUIRE(compressedBody.length() > 2);
+    CHECK(static_cast<unsigned char>(compressedBody[0]) == 0x1f);
+    CHECK(static_cast<unsigned char>(compressedBody[1]) == 0x8b);
+    CHECK(compressedBody.length() < body.length());
+
+    // Codings are matched whole, and a quality of zero refuses one.
+    CHECK_FALSE(HasHttpHeader(HttpGet(port, "/json/protocol", "Accept-Encoding: gzip;q=0, deflate\r\n"),
+        "Content-Encoding: gzip"));
+    CHECK_FALSE(HasHttpHeader(HttpGet(port, "/json/protocol", "Accept-Encoding: x-gzip-foo\r\n"),
+        "Content-Encoding: gzip"));
+    CHECK(HasHttpHeader(HttpGet(port, "/json/protocol", "Accept-Encoding: deflate, GZIP;q=0.5\r\n"),
+        "Content-Encoding: gzip"));
+
+    CHECK(HttpGet(port, "/missing").compare(0, 22, "HTTP/1.1 404 Not Found") == 0);
+
+    REQUIRE(JsDebugServiceClose(this->GetService()) == JsNoError);
+}
@@ -0,0 +1,90 @@
+// Load test for JsDebugService. It needs a running host with debugging enabled, for example:
+//   ChakraCore.Debugger.Sample.exe --inspect --io-threads 4 test.js
+// and is skipped unless CHAKRA_DEBUGGER_PORT is set. Requires a Node.js version with global fetch and WebSocket.
+var assert = require('assert');
+
+var port = process.env.CHAKRA_DEBUGGER_PORT;
+var clientCount = parseInt(process.env.CHAKRA_DEBUGGER_CLIENTS || "16", 10);
+var requestsPerClient = parseInt(process.env.CHAKRA_DEBUGGER_REQUESTS || "200", 10);
+
+function getTargets() {
+    return fetch("http://127.0.0.1:" + port + "/json/list").then(function(response) {
+        assert.strictEqual(response.status, 200);
+        return response.json();
+    });
+}
+
+function runSession(url) {
+    return new Promise(function(resolve, reject) {
+        var socket = new WebSocket(url);
+        var received = 0;
+
+        socket.onopen = function() {
+            for (var id = 0; id < requestsPerClient; ++id) {
+                socket.send(JSON.stringify({ id: id, method: "Schema.getDomains" }));
+            }
+        };
+        socket.onmessage = function(event) {
+            var message = JSON.parse(event.data);
+            if (message.id !== undefined) {
+                assert.strictEqual(message.id, received);
+                if (++received === requestsPerClient) {
+                    socket.close();
+                    resolve(received);
+                }
+            }
+        };
+        socket.onerror = function() {
+            reject(new Error("Connection to " + url + " failed"));
+        };
+    });
+}
+
+describe("serviceLoadTests", function() {
+    this.timeout(60000);
+
+    before(function() {
+        if (!port) {
+            this.skip();
+        }
+    });
+
+    it("case with concurrent target list requests", function() {
+        var requests = [];
+        for (var i = 0; i < clientCount; ++i) {
+            requests.push(getTargets());
+        }
+
+        return Promise.all(requests).then(function(lists) {
+            lists.forEach(function(list) {
+                assert.strictEqual(list.length, lists[0].length);
+            });
+        });
+    });
+
+    it("case with the protocol document", function() {
+        return fetch("http://127.0.0.1:" + port + "/json/protocol").then(function(response) {
+            assert.strictEqual(response.status, 200);
+            return response.json();
+        }).then(function(protocol) {
+            var domains = protocol.domains.map(function(domain) { return domain.domain; });
+            assert.ok(domains.indexOf("Debugger") !== -1);
+            assert.ok(domains.indexOf("Runtime") !== -1);
+        });
+    });
+
+    it("case with one concurrent session per target", function() {
+        return getTargets().then(function(targets) {
+            var start = Date.now();
+            var sessions = targets.slice(0, clientCount).map(function(target) {
+                return runSession(target.webSocketDebuggerUrl);
+            });
+
+            return Promise.all(sessions).then(function(results) {
+                var total = results.reduce(function(sum, count) { return sum + count; }, 0);
+                console.log("      " + total + " responses over " + results.length + " sessions in " +
+                    (Date.now() - start) + "ms");
+            });
+        });
+    });
+});